@@ -0,0 +1,160 @@
+/*
+ * File:   busCapture.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:05 PM
+ */
+
+
+#include "xc.h"
+#include "busCapture.h"
+#include "scheduler.h"
+
+#if BUS_CAPTURE
+
+#define HEADER_SIZE 11
+
+/* Operation being put together on one bus */
+typedef struct {
+    uint8_t addr;
+    unsigned long start;
+    unsigned int len;
+    uint8_t data[CAPTURE_MAX_DATA];
+    unsigned truncated : 1;
+} staging_t;
+
+static struct {
+    staging_t staging[2]; // One per bus, they can be mid-operation at the same time
+
+    uint8_t ring[CAPTURE_SIZE];
+    unsigned int head;
+    unsigned int cnt;
+    unsigned long dropped;
+} _module;
+
+void CaptureStart(uint8_t bus, uint8_t addr)
+{
+    staging_t *op = &_module.staging[bus];
+    op->addr = addr;
+    op->len = 0;
+    op->truncated = 0;
+    op->start = Cycles();
+}
+
+void CaptureByte(uint8_t bus, uint8_t b)
+{
+    staging_t *op = &_module.staging[bus];
+    if(op->len >= CAPTURE_MAX_DATA) {
+        op->truncated = 1;
+        return;
+    }
+    op->data[op->len++] = b;
+}
+
+void CapturePair(uint8_t bus, uint8_t tx)
+{
+    CaptureByte(bus, tx);
+    CaptureByte(bus, 0);
+}
+
+void CaptureReply(uint8_t bus, uint8_t rx)
+{
+    staging_t *op = &_module.staging[bus];
+    if(op->len > 0 && !op->truncated) op->data[op->len - 1] = rx;
+}
+
+void RingPut(uint8_t b)
+{
+    _module.ring[_module.head] = b;
+    if(++_module.head >= CAPTURE_SIZE) _module.head = 0;
+}
+
+void CaptureEnd(uint8_t bus, uint8_t flags)
+{
+    staging_t *op = &_module.staging[bus];
+    unsigned long duration = Cycles() - op->start;
+    unsigned int i = 0;
+
+    if(duration > 0xFFFF) duration = 0xFFFF;
+    flags |= bus;
+    if(op->truncated) flags |= CAPTURE_TRUNCATED;
+
+    /* SPI finishes in the DMA interrupt, so keep it off the ring while we're in it */
+    __builtin_disi(0x3FFF);
+    if(_module.cnt + HEADER_SIZE + op->len > CAPTURE_SIZE) {
+        _module.dropped++;
+        __builtin_disi(0);
+        return;
+    }
+    RingPut(CAPTURE_MARK);
+    RingPut(flags);
+    RingPut(op->addr);
+    RingPut(op->len & 0xFF);
+    RingPut(op->len >> 8);
+    RingPut(op->start & 0xFF);
+    RingPut((op->start >> 8) & 0xFF);
+    RingPut((op->start >> 16) & 0xFF);
+    RingPut(op->start >> 24);
+    RingPut(duration & 0xFF);
+    RingPut(duration >> 8);
+    for(; i < op->len; ++i) {
+        RingPut(op->data[i]);
+    }
+    _module.cnt += HEADER_SIZE + op->len;
+    __builtin_disi(0);
+}
+
+unsigned int CaptureRead(uint8_t *out, unsigned int max)
+{
+    unsigned int index;
+    unsigned int i = 0;
+
+    __builtin_disi(0x3FFF);
+    index = (_module.head + CAPTURE_SIZE - _module.cnt) % CAPTURE_SIZE;
+    for(; i < max && i < _module.cnt; ++i) {
+        out[i] = _module.ring[index];
+        if(++index >= CAPTURE_SIZE) index = 0;
+    }
+    _module.cnt -= i;
+    __builtin_disi(0);
+    return i;
+}
+
+unsigned long CaptureDropped()
+{
+    return _module.dropped;
+}
+
+#else
+
+void CaptureStart(uint8_t bus, uint8_t addr)
+{
+}
+
+void CaptureByte(uint8_t bus, uint8_t b)
+{
+}
+
+void CapturePair(uint8_t bus, uint8_t tx)
+{
+}
+
+void CaptureReply(uint8_t bus, uint8_t rx)
+{
+}
+
+void CaptureEnd(uint8_t bus, uint8_t flags)
+{
+}
+
+unsigned int CaptureRead(uint8_t *out, unsigned int max)
+{
+    return 0;
+}
+
+unsigned long CaptureDropped()
+{
+    return 0;
+}
+
+#endif
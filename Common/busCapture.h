@@ -0,0 +1,69 @@
+
+#ifndef __BUS_CAPTURE_H_
+#define	__BUS_CAPTURE_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+
+/* Set to 1 in the project to capture, at 0 every CAPTURE_*() compiles to nothing */
+#ifndef BUS_CAPTURE
+#define BUS_CAPTURE 0
+#endif
+
+#define CAPTURE_SIZE 1024    // Ring of finished records
+#define CAPTURE_MAX_DATA 160 // Per operation, anything past this is cut off
+
+#define BUS_I2C 0
+#define BUS_SPI 1
+
+/*
+ * Every operation is one record, all fields little endian
+ *   0xC5, flags, addr, len (2), start cycles (4), duration cycles (2), data[len]
+ * flags are the bus in the low two bits, then
+ */
+#define CAPTURE_MARK      0xC5
+#define CAPTURE_TRUNCATED 0x20
+#define CAPTURE_FAILED    0x40
+#define CAPTURE_READ      0x80
+/*
+ * addr is the I2C address, or for SPI the chip-select bit with 0x80 set for
+ * port A. I2C data is the bytes that went either way, SPI data is tx, rx
+ * pairs for each byte of the chip-select window.
+ */
+
+#if BUS_CAPTURE
+#define CAPTURE_START(bus, addr) CaptureStart((bus), (addr))
+#define CAPTURE_BYTE(bus, b)     CaptureByte((bus), (b))
+#define CAPTURE_PAIR(bus, tx)    CapturePair((bus), (tx))
+#define CAPTURE_REPLY(bus, rx)   CaptureReply((bus), (rx))
+#define CAPTURE_END(bus, flags)  CaptureEnd((bus), (flags))
+#else
+#define CAPTURE_START(bus, addr) ((void)0)
+#define CAPTURE_BYTE(bus, b)     ((void)0)
+#define CAPTURE_PAIR(bus, tx)    ((void)0)
+#define CAPTURE_REPLY(bus, rx)   ((void)0)
+#define CAPTURE_END(bus, flags)  ((void)0)
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void CaptureStart(uint8_t bus, uint8_t addr);
+    void CaptureByte(uint8_t bus, uint8_t b);
+    void CapturePair(uint8_t bus, uint8_t tx); // Leaves room for the byte that came back
+    void CaptureReply(uint8_t bus, uint8_t rx); // Fills in the last pair
+    void CaptureEnd(uint8_t bus, uint8_t flags);
+
+    /*
+     * Takes bytes out of the stream oldest first, returns how many. A record
+     * can be split across calls, joined back up in order they're the stream.
+     */
+    unsigned int CaptureRead(uint8_t *out, unsigned int max);
+    unsigned long CaptureDropped();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,298 @@
+/*
+ * File:   scheduler.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 6:20 PM
+ */
+
+
+#include "xc.h"
+#include "scheduler.h"
+#include "trace.h"
+
+#define NO_TASK 0xFF
+
+typedef struct {
+    void (*fn)(void);
+
+    unsigned int expires; // Tick the task is due on while it's on the wheel
+    unsigned int period;
+    unsigned int due;     // Tick the pending timed run was due on
+    uint8_t next;         // Next task in the same wheel slot
+    volatile uint8_t runnable; // Own byte, so setting it from an ISR can't clobber the bits below
+
+    taskStats_t stats;
+
+    unsigned onWheel : 1;
+    unsigned timed : 1;   // Pending run came from the wheel
+} task_t;
+
+static struct {
+    task_t tasks[MAX_TASKS];
+    uint8_t cnt;
+
+    uint8_t wheel[WHEEL_SIZE]; // First task in each slot
+    unsigned int wheelTime;    // Last tick the wheel was turned to
+
+    unsigned int period;       // Cycles per tick, PR1 + 1
+    unsigned long idleCycles;
+    unsigned long windowStart; // Cycles() when the current load window opened
+    unsigned long windowIdle;  // idleCycles at the same point
+    unsigned int load;
+
+    volatile unsigned int ticks;
+    volatile unsigned long tickCnt;
+    volatile unsigned int lastEntry;
+    volatile unsigned int maxEntry;
+} _module;
+
+/*=============================================================================
+Timer1 Interrupt Service Routine
+=============================================================================*/
+void __attribute__((interrupt, no_auto_psv)) _T1Interrupt(void)
+{
+    /* TMR1 restarted from 0 at the period match, so this is how late we are */
+    unsigned int entry = TMR1;
+
+    _module.ticks++;
+    _module.tickCnt++;
+    _module.lastEntry = entry;
+    if(entry > _module.maxEntry) _module.maxEntry = entry;
+    IFS0bits.T1IF = 0;		//Clear the Timer1 Interrupt Flag
+}
+
+void WheelInsert(uint8_t id)
+{
+    task_t *task = &_module.tasks[id];
+    uint8_t slot = task->expires % WHEEL_SIZE;
+
+    task->next = _module.wheel[slot];
+    _module.wheel[slot] = id;
+    task->onWheel = 1;
+}
+
+void WheelRemove(uint8_t id)
+{
+    task_t *task = &_module.tasks[id];
+    uint8_t *link = &_module.wheel[task->expires % WHEEL_SIZE];
+
+    if(!task->onWheel) return;
+    while(*link != NO_TASK) {
+        if(*link == id) {
+            *link = task->next;
+            break;
+        }
+        link = &_module.tasks[*link].next;
+    }
+    task->onWheel = 0;
+}
+
+/*
+ * Moves the wheel up one tick. Only the tasks hashed into this slot get
+ * looked at, and the ones due some later lap go right back in.
+ */
+void WheelTurn()
+{
+    uint8_t slot;
+    uint8_t id;
+
+    _module.wheelTime++;
+    slot = _module.wheelTime % WHEEL_SIZE;
+    id = _module.wheel[slot];
+    _module.wheel[slot] = NO_TASK;
+
+    while(id != NO_TASK) {
+        task_t *task = &_module.tasks[id];
+        uint8_t next = task->next;
+
+        if(task->expires == _module.wheelTime) {
+            task->due = task->expires;
+            task->timed = 1;
+            task->runnable = 1;
+            task->onWheel = 0;
+            if(task->period) {
+                /* From when it was due, not when it runs, so it can't drift */
+                task->expires += task->period;
+                WheelInsert(id);
+            }
+        } else {
+            WheelInsert(id);
+        }
+        id = next;
+    }
+}
+
+void InitScheduler(unsigned long fcy)
+{
+    unsigned int i = 0;
+
+    for(; i < WHEEL_SIZE; ++i) {
+        _module.wheel[i] = NO_TASK;
+    }
+    _module.cnt = 0;
+    _module.ticks = 0;
+    _module.tickCnt = 0;
+    _module.wheelTime = 0;
+
+    _module.period = fcy / SCHEDULER_TICK_HZ;
+    _module.idleCycles = 0;
+    _module.windowStart = 0;
+    _module.windowIdle = 0;
+    _module.load = 0;
+
+    T1CON = 0;                 // TSIDL clear, keeps ticking in Idle
+    TMR1 = 0;
+    PR1 = _module.period - 1;  // Period match resets TMR1 in hardware
+    IFS0bits.T1IF = 0;
+    IEC0bits.T1IE = 1;
+    T1CONbits.TON = 1;
+}
+
+/* Returns the task id, or -1 when every slot is taken */
+int TaskCreate(void (*fn)(void))
+{
+    task_t *task;
+
+    if(_module.cnt >= MAX_TASKS) return -1;
+    task = &_module.tasks[_module.cnt];
+    task->fn = fn;
+    task->onWheel = 0;
+    task->timed = 0;
+    task->runnable = 0;
+    return _module.cnt++;
+}
+
+void TaskSchedule(int task, unsigned int delay, unsigned int period)
+{
+    if(task < 0 || task >= _module.cnt) return;
+    WheelRemove(task);
+    /* A delay of 0 would be this tick, which the wheel has already passed */
+    if(delay == 0) delay = 1;
+    _module.tasks[task].expires = _module.wheelTime + delay;
+    _module.tasks[task].period = period;
+    WheelInsert(task);
+}
+
+void TaskCancel(int task)
+{
+    if(task < 0 || task >= _module.cnt) return;
+    WheelRemove(task);
+}
+
+void SchedulerMarkRunnable(int task)
+{
+    if(task < 0 || task >= _module.cnt) return;
+    _module.tasks[task].runnable = 1;
+}
+
+int AnyRunnable()
+{
+    uint8_t id = 0;
+
+    if(_module.wheelTime != _module.ticks) return 1;
+    for(; id < _module.cnt; ++id) {
+        if(_module.tasks[id].runnable) return 1;
+    }
+    return 0;
+}
+
+void UpdateLoad()
+{
+    unsigned long now = Cycles();
+    unsigned long elapsed = now - _module.windowStart;
+    unsigned long idle;
+
+    if(elapsed < (unsigned long) _module.period * LOAD_WINDOW) return;
+    idle = _module.idleCycles - _module.windowIdle;
+    if(idle > elapsed) idle = elapsed;
+    /* Divide first, cycles * 100 could overflow at higher clocks */
+    _module.load = 100 - (unsigned int) (idle / (elapsed / 100));
+    _module.windowStart = now;
+    _module.windowIdle = _module.idleCycles;
+}
+
+void SchedulerProcess()
+{
+    unsigned long start;
+    uint8_t id = 0;
+
+    while(_module.wheelTime != _module.ticks) WheelTurn();
+
+    for(; id < _module.cnt; ++id) {
+        task_t *task = &_module.tasks[id];
+        if(!task->runnable) continue;
+        task->runnable = 0;
+
+        if(task->timed) {
+            task->timed = 0;
+            task->stats.lastLate = _module.ticks - task->due;
+            if(task->stats.lastLate > task->stats.maxLate) task->stats.maxLate = task->stats.lastLate;
+        }
+        task->stats.runs++;
+        TRACE(TRACE_TASK_START, id);
+        start = Cycles();
+        (*task->fn)();
+        task->stats.cycles += Cycles() - start;
+        TRACE(TRACE_TASK_END, id);
+    }
+
+    UpdateLoad();
+
+    /*
+     * An interrupt that marks a task right after this check doesn't stop the
+     * Idle, but the next tick wakes us anyway, so the worst case is one tick
+     * late. Interrupts taken while idle are counted as idle time.
+     */
+    if(AnyRunnable()) return;
+    TRACE(TRACE_IDLE, 0);
+    start = Cycles();
+    Idle();
+    _module.idleCycles += Cycles() - start;
+}
+
+unsigned int Millis()
+{
+    return _module.ticks;
+}
+
+unsigned long Cycles()
+{
+    unsigned long ticks;
+    unsigned int tmr;
+    unsigned int wrapped;
+
+    /* Tick count is two words, so go again if the ISR got in between */
+    do {
+        ticks = _module.tickCnt;
+        tmr = TMR1;
+        wrapped = IFS0bits.T1IF;
+    } while(ticks != _module.tickCnt);
+    /* Timer already wrapped but the ISR hasn't counted it yet */
+    if(wrapped && tmr < _module.period / 2) ticks++;
+    return ticks * _module.period + tmr;
+}
+
+unsigned long IdleCycles()
+{
+    return _module.idleCycles;
+}
+
+unsigned int CpuLoad()
+{
+    return _module.load;
+}
+
+void GetTaskStats(int task, taskStats_t *stats)
+{
+    if(task < 0 || task >= _module.cnt) return;
+    *stats = _module.tasks[task].stats;
+}
+
+void GetTickStats(tickStats_t *stats)
+{
+    IEC0bits.T1IE = 0;
+    stats->ticks = _module.tickCnt;
+    stats->lastEntry = _module.lastEntry;
+    stats->maxEntry = _module.maxEntry;
+    IEC0bits.T1IE = 1;
+}
@@ -0,0 +1,65 @@
+
+#ifndef __SCHEDULER_H_
+#define	__SCHEDULER_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+
+#define SCHEDULER_TICK_HZ 1000 // Millis() counts these
+#define MAX_TASKS 16
+#define WHEEL_SIZE 32          // Slots on the timer wheel, one tick each
+#define LOAD_WINDOW 1000       // Ticks CpuLoad() is averaged over
+
+typedef struct {
+    unsigned long runs;
+    unsigned int lastLate; // Ticks a timed run went out after it was due
+    unsigned int maxLate;
+    unsigned long cycles;  // Instruction cycles spent inside the task
+} taskStats_t;
+
+typedef struct {
+    unsigned long ticks;
+    unsigned int lastEntry; // Timer1 cycles between the period match and the ISR
+    unsigned int maxEntry;
+} tickStats_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /* Timer1 runs off fcy and reloads from PR1, so ticks never drift */
+    void InitScheduler(unsigned long fcy);
+
+    /*
+     * Tasks only run when they're runnable, either because their time on the
+     * wheel came up or because someone marked them. A task runs at most once
+     * per SchedulerProcess no matter how many times it was marked.
+     */
+    int TaskCreate(void (*fn)(void));
+    void TaskSchedule(int task, unsigned int delay, unsigned int period); // period 0 for one-shot
+    void TaskCancel(int task);
+    void SchedulerMarkRunnable(int task); // Safe from interrupts
+
+    /*
+     * Runs everything due or marked, call it from the main loop. When there
+     * is nothing to do the core goes into Idle until the next interrupt, so
+     * every peripheral that wakes a task has to keep running in Idle.
+     */
+    void SchedulerProcess();
+
+    unsigned int Millis();
+
+    /* Instruction cycles since InitScheduler, off Timer1, wraps */
+    unsigned long Cycles();
+    unsigned long IdleCycles();
+    /* Percent of the last LOAD_WINDOW ticks spent out of Idle */
+    unsigned int CpuLoad();
+
+    void GetTaskStats(int task, taskStats_t *stats);
+    void GetTickStats(tickStats_t *stats);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,96 @@
+/*
+ * File:   trace.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 7:45 PM
+ */
+
+
+#include "xc.h"
+#include "trace.h"
+
+#if TRACE_ENABLE
+
+static struct {
+    traceEntry_t entries[TRACE_SIZE];
+    unsigned int head;
+    unsigned int cnt;
+    unsigned long recorded;
+} _module;
+
+/* Timer2 and Timer3 chained into one 32 bit counter at Fcy, never stopped */
+void InitTrace()
+{
+    T2CON = 0;
+    T3CON = 0;
+    T2CONbits.T32 = 1;
+    TMR3 = 0;
+    TMR2 = 0;
+    PR3 = 0xFFFF;
+    PR2 = 0xFFFF;
+    T2CONbits.TON = 1;
+
+    _module.head = 0;
+    _module.cnt = 0;
+    _module.recorded = 0;
+}
+
+void TraceRecord(uint8_t id, uint8_t arg)
+{
+    traceEntry_t *entry;
+
+    /* Keep an interrupt from grabbing the same slot */
+    __builtin_disi(0x3FFF);
+    entry = &_module.entries[_module.head];
+    entry->time = TMR2; // Reading TMR2 latches TMR3 into TMR3HLD
+    entry->time |= (unsigned long) TMR3HLD << 16;
+    entry->id = id;
+    entry->arg = arg;
+    if(++_module.head >= TRACE_SIZE) _module.head = 0;
+    if(_module.cnt < TRACE_SIZE) _module.cnt++;
+    _module.recorded++;
+    __builtin_disi(0);
+}
+
+unsigned int TraceRead(traceEntry_t *out, unsigned int max)
+{
+    unsigned int i = 0;
+    unsigned int index;
+
+    __builtin_disi(0x3FFF);
+    index = (_module.head + TRACE_SIZE - _module.cnt) % TRACE_SIZE;
+    for(; i < max && i < _module.cnt; ++i) {
+        out[i] = _module.entries[index];
+        if(++index >= TRACE_SIZE) index = 0;
+    }
+    _module.cnt -= i;
+    __builtin_disi(0);
+    return i;
+}
+
+unsigned long TraceRecorded()
+{
+    return _module.recorded;
+}
+
+#else
+
+void InitTrace()
+{
+}
+
+void TraceRecord(uint8_t id, uint8_t arg)
+{
+}
+
+unsigned int TraceRead(traceEntry_t *out, unsigned int max)
+{
+    return 0;
+}
+
+unsigned long TraceRecorded()
+{
+    return 0;
+}
+
+#endif
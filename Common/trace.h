@@ -0,0 +1,61 @@
+
+#ifndef __TRACE_H_
+#define	__TRACE_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+
+/* Set to 1 in the project to record, at 0 every TRACE() compiles to nothing */
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE 0
+#endif
+
+#define TRACE_SIZE 128 // Entries kept, oldest are overwritten first
+
+/*
+ * Event ids, the high nibble is the family. Tools/traceDecode.c measures a
+ * phase from one event to the next one in the same family, and for the
+ * command family from the same reader, so keep the two in step when adding
+ * any.
+ */
+#define TRACE_TASK_START  0x10 // arg task id
+#define TRACE_TASK_END    0x11 // arg task id
+#define TRACE_IDLE        0x12 // Scheduler went into Idle
+#define TRACE_I2C_STATE   0x20 // arg state entered
+#define TRACE_LCD_STATE   0x30 // arg state entered
+#define TRACE_CMD_START   0x40 // arg TRACE_CMD_ARG
+#define TRACE_CMD_DONE    0x41 // arg TRACE_CMD_ARG
+#define TRACE_CMD_TIMEOUT 0x42 // arg TRACE_CMD_ARG
+
+/* Reader index in the high nibble, its MFRC522 command (4 bits) in the low */
+#define TRACE_CMD_ARG(reader, cmd) ((uint8_t)(((reader) << 4) | ((cmd) & 0x0F)))
+
+/* Dumps are a plain array of these, little endian, 6 bytes each */
+typedef struct {
+    unsigned long time; // Instruction cycles off Timer2/3
+    uint8_t id;
+    uint8_t arg;
+} traceEntry_t;
+
+#if TRACE_ENABLE
+#define TRACE(id, arg) TraceRecord((id), (arg))
+#else
+#define TRACE(id, arg) ((void)0)
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void InitTrace();
+    void TraceRecord(uint8_t id, uint8_t arg);
+
+    /* Copies out oldest first and drops what it copied, returns entries copied */
+    unsigned int TraceRead(traceEntry_t *out, unsigned int max);
+    unsigned long TraceRecorded();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,204 @@
+/*
+ * File:   uartDriver.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 9:10 PM
+ */
+
+
+#include "xc.h"
+#include "uartDriver.h"
+#include "trace.h"
+#include "busCapture.h"
+
+/**
+ *  UART Pin assignments
+ * U1TX - RP7 (16)
+ */
+
+/**
+ *  RPN Codes
+ * U1TX 00011
+ */
+
+/**
+ *  DMA assignments
+ * DMA2 - RAM to U1TXREG, one contiguous piece of the ring at a time
+ */
+#define DMA_REQ_U1TX 0x0C
+
+static uint8_t _buf[UART_BUFFER_SIZE] __attribute__((space(dma)));
+
+static struct {
+    volatile unsigned int head; // Next byte to fill, only moved by LogWrite
+    volatile unsigned int tail; // Next byte to send, only moved by the DMA interrupt
+    unsigned int chunk;         // Bytes in the transfer that's running
+
+    unsigned long dropped;
+    unsigned long sent;
+
+    volatile unsigned busy : 1;
+}_module;
+
+/* Sends from tail up to head, or to the end of the buffer if head wrapped */
+void StartChunk()
+{
+    unsigned int end = (_module.head > _module.tail) ? _module.head : UART_BUFFER_SIZE;
+
+    _module.chunk = end - _module.tail;
+    _module.busy = 1;
+    DMA2STA = __builtin_dmaoffset(_buf) + _module.tail;
+    DMA2CNT = _module.chunk - 1;
+    DMA2CONbits.CHEN = 1;
+    /* UART only requests when a byte moves out, so start the first one */
+    DMA2REQbits.FORCE = 1;
+}
+
+/*=============================================================================
+DMA2 (UART1 TX) Interrupt Service Routine
+=============================================================================*/
+void __attribute__((interrupt, no_auto_psv)) _DMA2Interrupt(void)
+{
+    unsigned int tail = _module.tail + _module.chunk;
+
+    if(tail >= UART_BUFFER_SIZE) tail = 0;
+    _module.tail = tail;
+    _module.sent += _module.chunk;
+    if(_module.tail != _module.head) StartChunk();
+    else _module.busy = 0;
+    IFS1bits.DMA2IF = 0;		//Clear the DMA2 Interrupt Flag
+}
+
+unsigned long InitUART(unsigned long fcy, unsigned long baud)
+{
+    unsigned long brg = (fcy / 4 + baud / 2) / baud; // Rounded
+
+    RPOR3bits.RP7R = 0b00011; // RP7 (RB7)
+
+    U1MODE = 0;
+    U1MODEbits.BRGH = 1; // 4 clocks per bit, highest rates
+    if(brg == 0) brg = 1;
+    U1BRG = brg - 1;
+    U1STA = 0;
+
+    /* Byte-wide, RAM to peripheral, one-shot */
+    DMA2CON = 0;
+    DMA2CONbits.SIZE = 1;
+    DMA2CONbits.DIR = 1;
+    DMA2CONbits.MODE = 0b01;
+    DMA2REQ = DMA_REQ_U1TX;
+    DMA2PAD = (volatile unsigned int) &U1TXREG;
+
+    _module.head = 0;
+    _module.tail = 0;
+    _module.busy = 0;
+
+    IFS1bits.DMA2IF = 0;
+    IEC1bits.DMA2IE = 1;
+
+    U1MODEbits.UARTEN = 1; // USIDL clear, keeps sending in Idle
+    U1STAbits.UTXEN = 1;
+    return fcy / (4 * brg);
+}
+
+unsigned int LogFree()
+{
+    unsigned int used = (_module.head + UART_BUFFER_SIZE - _module.tail) % UART_BUFFER_SIZE;
+    /* One byte stays empty so a full buffer doesn't look like an empty one */
+    return UART_BUFFER_SIZE - 1 - used;
+}
+
+void Put(uint8_t b)
+{
+    _buf[_module.head] = b;
+    if(++_module.head >= UART_BUFFER_SIZE) _module.head = 0;
+}
+
+/* Starts the DMA if it ran dry, whatever was put since goes out with it */
+void Kick()
+{
+    IEC1bits.DMA2IE = 0;
+    if(!_module.busy && _module.tail != _module.head) StartChunk();
+    IEC1bits.DMA2IE = 1;
+}
+
+int LogWrite(const uint8_t *dat, unsigned int len)
+{
+    unsigned int i = 0;
+
+    if(len > LogFree()) {
+        _module.dropped++;
+        return -1;
+    }
+    for(; i < len; ++i) {
+        Put(dat[i]);
+    }
+    Kick();
+    return 0;
+}
+
+int LogRecord(uint8_t type, const uint8_t *payload, unsigned int len)
+{
+    uint8_t check = type + len;
+    unsigned int i = 0;
+
+    if(len > LOG_MAX_PAYLOAD || len + 4 > LogFree()) {
+        _module.dropped++;
+        return -1;
+    }
+    Put(LOG_SYNC);
+    Put(type);
+    Put(len);
+    for(; i < len; ++i) {
+        Put(payload[i]);
+        check += payload[i];
+    }
+    Put(-check);
+    Kick();
+    return 0;
+}
+
+/* Moves whatever the trace buffer holds out as LOG_TRACE records, as far as there's room */
+void LogTrace()
+{
+#if TRACE_ENABLE
+    traceEntry_t entries[LOG_MAX_PAYLOAD / sizeof(traceEntry_t)];
+    unsigned int cnt;
+
+    while(LogFree() >= LOG_MAX_PAYLOAD + 4) {
+        cnt = TraceRead(entries, LOG_MAX_PAYLOAD / sizeof(traceEntry_t));
+        if(cnt == 0) break;
+        LogRecord(LOG_TRACE, (uint8_t *) entries, cnt * sizeof(traceEntry_t));
+    }
+#endif
+}
+
+void LogCapture()
+{
+#if BUS_CAPTURE
+    uint8_t chunk[LOG_MAX_PAYLOAD];
+    unsigned int cnt;
+
+    /* Only take out what's sure to fit, a lost slice would break the stream */
+    while(LogFree() >= LOG_MAX_PAYLOAD + 4) {
+        cnt = CaptureRead(chunk, LOG_MAX_PAYLOAD);
+        if(cnt == 0) break;
+        LogRecord(LOG_CAPTURE, chunk, cnt);
+    }
+#endif
+}
+
+unsigned long LogDropped()
+{
+    return _module.dropped;
+}
+
+/* Bytes that have gone out over the wire */
+unsigned long LogSent()
+{
+    unsigned long sent;
+    IEC1bits.DMA2IE = 0;
+    sent = _module.sent;
+    IEC1bits.DMA2IE = 1;
+    return sent;
+}
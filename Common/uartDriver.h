@@ -0,0 +1,60 @@
+
+#ifndef __UART_DRIVER_H_
+#define	__UART_DRIVER_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+
+#define UART_BUFFER_SIZE 256
+
+/*
+ * Records go out as
+ *   0xA5, type, len, payload[len], check
+ * where check makes type + len + payload + check add up to 0.
+ */
+#define LOG_SYNC 0xA5
+#define LOG_MAX_PAYLOAD 64
+
+// Record types
+#define LOG_TEXT     0x00
+#define LOG_UID      0x01 // Reader (top bit set on departure), then the UID bytes
+#define LOG_COUNTERS 0x02 // Little endian words, meaning depends on the firmware
+#define LOG_TRACE    0x03 // traceEntry_t array, see Common/trace.h
+#define LOG_LATENCY  0x04 // Little endian longs, last and max us per stage, then overruns
+#define LOG_CAPTURE  0x05 // Slice of the bus capture stream, see Common/busCapture.h
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /*
+     * Returns the baud rate that will actually be used, fcy / (4 * n) for a
+     * whole n. At the 3.685 MHz FRC clock 460800 is n = 2 and 0.04% slow,
+     * the next rates up are 614 and 921 kbaud.
+     */
+    unsigned long InitUART(unsigned long fcy, unsigned long baud);
+
+    /*
+     * Neither call ever waits. If the whole thing doesn't fit in the buffer
+     * it's dropped and counted, a record is never sent half way.
+     */
+    int LogWrite(const uint8_t *dat, unsigned int len);
+    int LogRecord(uint8_t type, const uint8_t *payload, unsigned int len);
+
+    /* Empties the trace buffer into the log, does nothing without TRACE_ENABLE */
+    void LogTrace();
+    /*
+     * Same for the bus capture. Records get split across log records, the
+     * payloads joined back up in order are the capture stream.
+     */
+    void LogCapture();
+
+    unsigned long LogDropped();
+    unsigned long LogSent();
+    unsigned int LogFree();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -3,9 +3,11 @@
 
 #include <xc.h> // include processor files - each processor file is guarded.  
 
-#define CLOCK_RATE (8000000)
-
-#define MIPS (CLOCK_RATE / 4000000)
+/*
+ * Instruction clock. FNOSC = FRC with no PLL, so this is the nominal
+ * 7.37 MHz FRC over 2. Change it with FNOSC if the PLL is ever switched on.
+ */
+#define CLOCK_RATE (3685000)
 
 #ifdef	__cplusplus
 extern "C" {
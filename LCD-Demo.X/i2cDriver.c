@@ -8,6 +8,9 @@
 
 #include "xc.h"
 #include "i2cDriver.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
+#include "../Common/busCapture.h"
 
 #define TRANSACTION_COUNT 16
 #define BYTE_COUNT 16
@@ -49,6 +52,8 @@ static struct {
     unsigned int startCnt;
     unsigned int endCnt;
     
+    int task;
+    
     volatile unsigned callback : 1;
     
 }_module;
@@ -67,12 +72,40 @@ int messageCnt() {
     else return cnt + TRANSACTION_COUNT;
 }
 
+/* Hands the bytes that made it over the bus to the capture layer */
+void captureTransaction(transaction_t *t, uint8_t flags) {
+    unsigned int i = 0;
+    for(; i < t->start; ++i) {
+        CAPTURE_BYTE(BUS_I2C, t->dat[i]);
+    }
+    if(t->read) flags |= CAPTURE_READ;
+    CAPTURE_END(BUS_I2C, flags);
+}
+
+/* Whether the state machine can't go any further until the bus interrupts */
+int waitingOnBus() {
+    switch(_module.st) {
+        case Idle:
+            return messageCnt() == 0;
+        case Address:
+        case AddressAck:
+        case Data_R:
+        case Data_RAckAck:
+        case Data_TAck:
+        case StopAck:
+            return !_module.callback;
+        default:
+            return 0;
+    }
+}
+
 /*=============================================================================
 I2C Master Interrupt Service Routine
 =============================================================================*/
 void __attribute__((interrupt, no_auto_psv)) _MI2C1Interrupt(void)
 {
     _module.callback = 1;
+    SchedulerMarkRunnable(_module.task);
     IFS1bits.MI2C1IF = 0;		//Clear the DMA0 Interrupt Flag;
 }
 
@@ -85,9 +118,8 @@ void __attribute__((interrupt, no_auto_psv)) _SI2C1Interrupt(void)
 }
 
 void InitI2C() {
-    I2C1CONbits.I2CSIDL = 1;
+    I2C1CONbits.I2CSIDL = 0; // Keep running while the scheduler has the core in Idle
     I2C1CONbits.SCLREL = 0;
-    I2C1CONbits.I2CSIDL = 1;
     I2C1CONbits.I2CEN = 1;
     
     // Configure SCA/SDA pin as open-drain
@@ -105,11 +137,15 @@ void InitI2C() {
 	I2C1CONbits.I2CEN = 1; /* Enable I2C module */
 	IEC1bits.MI2C1IE = 1; /* Enable master interrupt */
   	IFS1bits.MI2C1IF = 0; /* Disable slave interrupt */
+    
+    /* Only runs when there's a transaction queued or the bus interrupted */
+    _module.task = TaskCreate(I2CProcess);
 }
 
 void I2CProcess() {
     
     transaction_t *queued = &_module.transactions[_module.startCnt];
+    enum states last = _module.st;
     
     /* State Machine Stuff */
     switch(_module.st) {
@@ -120,6 +156,7 @@ void I2CProcess() {
         case Start:
             /* Tell module to send start bit */
             I2C1CONbits.SEN = 1;
+            CAPTURE_START(BUS_I2C, queued->addr);
             _module.st = Address;
             break;
         case Address:
@@ -233,6 +270,7 @@ void I2CProcess() {
         case Stop:
             /* Send stop bit */
             I2C1CONbits.PEN = 1;
+            captureTransaction(queued, 0);
             /* Move to next transaction */
             incrementStart();
             (*queued->callbackFunction)(queued->dat);
@@ -249,11 +287,17 @@ void I2CProcess() {
             _module.st = Start;
             break;
         case Fail:
+            captureTransaction(queued, CAPTURE_FAILED);
             incrementStart();
             (*queued->callbackFunction)(0);
             _module.st = Idle;
             break;
     }
+    
+    if(_module.st != last) TRACE(TRACE_I2C_STATE, _module.st);
+    
+    /* States that don't wait on the bus go again on the next pass */
+    if(!waitingOnBus()) SchedulerMarkRunnable(_module.task);
 }
 
 int CreateTransaction(uint8_t address, uint8_t *bytes, unsigned int byteCnt, int read, void (*callback)(uint8_t*)) {
@@ -272,5 +316,6 @@ int CreateTransaction(uint8_t address, uint8_t *bytes, unsigned int byteCnt, int
     toFill->callbackFunction = callback;
     
     incrementEnd();
+    SchedulerMarkRunnable(_module.task);
     return 0;
 }
\ No newline at end of file
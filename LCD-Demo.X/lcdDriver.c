@@ -9,9 +9,14 @@
 #include "xc.h"
 #include "i2cDriver.h"
 #include "utils.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
 
 #define ADDRESS 0x27
 
+#define TEXT_QUEUE_SIZE 64
+#define TEXT_BYTES 16 // Expander bytes per I2C transaction, BYTE_COUNT in the I2C driver
+
 // Commands
 #define LCD_CLEARDISPLAY 0x01
 #define LCD_RETURNHOME 0x02
@@ -64,9 +69,15 @@ enum LCDStates {
     FinishInit, /* Finish off initialization */
     
     Idle,
-    WriteChar,
+    WriteChar, /* Sending queued text without blocking */
 };
 
+/* One HD44780 write waiting to go out, mode is 0 for a command or Rs for data */
+typedef struct {
+    uint8_t value;
+    uint8_t mode;
+} lcdOp_t;
+
 static struct {
     enum LCDStates st;
     
@@ -79,8 +90,15 @@ static struct {
     
     uint16_t time;
     
+    lcdOp_t ops[TEXT_QUEUE_SIZE];
+    unsigned int opStart;
+    unsigned int opCnt;
+    uint8_t lastMode; // Rs level the expander was last left at
+    int task;
+    
     unsigned backlight : 1; // Keep track of backlight state
     volatile unsigned i2cFinished : 1; // Set when callback is called
+    volatile unsigned textPending : 1; // Text transaction still on the bus
 } _module = {0};
 
 /****** Utility functions that get called occasionally *******/
@@ -93,6 +111,12 @@ void SetCallback(uint8_t *dat) {
     _module.i2cFinished = 1;
 }
 
+void TextCallback(uint8_t *dat) {
+    _module.textPending = 0;
+    /* Go straight on to the next batch instead of waiting for the tick */
+    SchedulerMarkRunnable(_module.task);
+}
+
 /****** Low Level Commands that interact with I2C driver *******/
 void ExpanderWrite(uint8_t value,  void (*callback)(uint8_t*)) {
     uint8_t dat = value;
@@ -243,6 +267,81 @@ int GetBacklight() {
   return _module.backlight == 1;
 }
 
+/****** Non-blocking text, goes out from the WriteChar state *******/
+
+int QueueOp(uint8_t value, uint8_t mode) {
+    lcdOp_t *op;
+    if(_module.opCnt >= TEXT_QUEUE_SIZE) return -1;
+    op = &_module.ops[(_module.opStart + _module.opCnt) % TEXT_QUEUE_SIZE];
+    op->value = value;
+    op->mode = mode;
+    _module.opCnt++;
+    return 0;
+}
+
+/*
+ * Packs as many queued writes as fit into one I2C transaction. Each nibble
+ * is a pair of expander bytes with En high then low, and a byte to settle
+ * Rs goes first whenever it changes. A byte on the bus takes longer than any
+ * command here needs, so no delays are required between them.
+ */
+void SendQueued() {
+    uint8_t dat[TEXT_BYTES];
+    uint8_t bl = _module.backlight << 3;
+    uint8_t mode = _module.lastMode;
+    unsigned int len = 0;
+    unsigned int taken = 0;
+    
+    while(taken < _module.opCnt) {
+        lcdOp_t *op = &_module.ops[(_module.opStart + taken) % TEXT_QUEUE_SIZE];
+        uint8_t hi = (op->value & 0xF0) | op->mode | bl;
+        uint8_t lo = ((op->value << 4) & 0xF0) | op->mode | bl;
+        unsigned int need = (op->mode != mode) ? 5 : 4;
+        
+        if(len + need > TEXT_BYTES) break;
+        if(op->mode != mode) dat[len++] = op->mode | bl;
+        dat[len++] = hi | En;
+        dat[len++] = hi;
+        dat[len++] = lo | En;
+        dat[len++] = lo;
+        mode = op->mode;
+        taken++;
+    }
+    
+    /* Queue in the I2C driver is full, try again next time around */
+    if(CreateTransaction(ADDRESS, dat, len, 0, TextCallback) < 0) return;
+    _module.textPending = 1;
+    _module.lastMode = mode;
+    _module.opStart = (_module.opStart + taken) % TEXT_QUEUE_SIZE;
+    _module.opCnt -= taken;
+}
+
+/*
+ * Writes str at col, row without waiting on the bus. Either all of it is
+ * queued or none of it is, returns -1 when there isn't room. Don't mix with
+ * the blocking calls while text is still going out.
+ */
+int PrintAt(uint8_t col, uint8_t row, const char *str) {
+    static const uint8_t rowOffsets[] = { 0x00, 0x40, 0x14, 0x54 };
+    unsigned int len = 0;
+    
+    while(str[len]) len++;
+    if(_module.opCnt + len + 1 > TEXT_QUEUE_SIZE) return -1;
+    if(row >= _module.rows) row = _module.rows - 1;
+    
+    QueueOp(LCD_SETDDRAMADDR | (col + rowOffsets[row]), 0);
+    for(; *str; ++str) {
+        QueueOp(*str, Rs);
+    }
+    SchedulerMarkRunnable(_module.task);
+    return 0;
+}
+
+/* Whether queued text still has to reach the display */
+int LcdBusy() {
+    return _module.opCnt > 0 || _module.textPending;
+}
+
 void Print(char *str) {
     int i = 0;
     for(; str[i] != 0; ++i) {
@@ -251,6 +350,8 @@ void Print(char *str) {
 }
 
 void LcdProcess() {
+    enum LCDStates last = _module.st;
+    
     switch(_module.st) {
         case Startup:
             _module.cols = 16;
@@ -300,16 +401,26 @@ void LcdProcess() {
             _module.displayMode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
             Command(LCD_ENTRYMODESET | _module.displayMode);
             Home();
+            _module.lastMode = 0xFF; // Unknown, so the first text write settles Rs
             
             _module.st = Idle;
             break;
             
         case Idle:
+            if(_module.opCnt > 0) _module.st = WriteChar;
             break;
         case WriteChar:
+            if(_module.textPending) break;
+            if(_module.opCnt == 0) {
+                _module.st = Idle;
+                break;
+            }
+            SendQueued();
             break;
             
     }
+    
+    if(_module.st != last) TRACE(TRACE_LCD_STATE, _module.st);
 }
 
 void LcdProcess1Ms() {
@@ -318,6 +429,18 @@ void LcdProcess1Ms() {
     }
 }
 
+void LcdTick() {
+    LcdProcess1Ms();
+    LcdProcess();
+}
+
+void InitLcd() {
+    /* Every state either waits out a delay or finishes in one go, so once a ms is plenty */
+    TaskSchedule(TaskCreate(LcdTick), 1, 1);
+    /* Text also runs the state machine as soon as it's queued or a batch is done */
+    _module.task = TaskCreate(LcdProcess);
+}
+
 int Ready() {
-    return _module.st == Idle;
+    return _module.st == Idle || _module.st == WriteChar;
 }
@@ -8,6 +8,7 @@
 extern "C" {
 #endif /* __cplusplus */
 
+void InitLcd();
 void Print(char *str);
 void LcdProcess();
 void LcdProcess1Ms();
@@ -15,6 +16,10 @@ int Ready();
 
 void SetCursor(uint8_t col, uint8_t row);
 
+// Non-blocking text, queued and sent a few characters per I2C transaction
+int PrintAt(uint8_t col, uint8_t row, const char *str);
+int LcdBusy();
+
 // Turn the display on/off (quickly)
 void NoDisplay();
 void Display();
@@ -7,8 +7,13 @@
 
 
 #include "xc.h"
+#include "global.h"
 #include "i2cDriver.h"
 #include "lcdDriver.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
+#include "../Common/uartDriver.h"
+#include "../Common/busCapture.h"
 
 #pragma config FNOSC = FRC
 #pragma config POSCMD = NONE
@@ -16,52 +21,52 @@
 #pragma config FCKSM = CSDCMD
 #pragma config FWDTEN = OFF
 
+#define LOG_BAUD 460800
+#define TELEMETRY_PERIOD 1000 // ms
+#define TRACE_PERIOD 10       // ms
+#define CAPTURE_PERIOD 10     // ms
+
 static struct {
-    unsigned long time;
-} _module = {0} ;
+    int startTask;
+} _module;
 
-void InitTimer() {
-    T1CONbits.TGATE = 0;
-    PR1 = 8000; // 8 Mhz Clock, which means 1 ms is 8000 cycles
-    T1CONbits.TON = 1;
-    
-    IEC0bits.T1IE = 0;
-    IFS0bits.T1IF = 0;
+/* Puts the demo text up once the display has come out of its init sequence */
+void StartScreen() {
+    if(!Ready()) return;
+    TaskCancel(_module.startTask);
+    Backlight();
+    Print("ABCDEFGHIJKLM");
+    SetCursor(0,1);
+    Print("NOPQRSTUVWXYZ");
+}
+
+/* CPU load, then dropped log writes */
+void TelemetryTask() {
+    uint16_t counters[2];
+    counters[0] = CpuLoad();
+    counters[1] = LogDropped();
+    LogRecord(LOG_COUNTERS, (uint8_t *) counters, sizeof(counters));
 }
 
 int main(void) {
-    InitTimer();
+    InitScheduler(CLOCK_RATE);
+    InitTrace();
+    InitUART(CLOCK_RATE, LOG_BAUD);
     InitI2C();
+    InitLcd();
     
-    int startcall = 1;
+    _module.startTask = TaskCreate(StartScreen);
+    TaskSchedule(_module.startTask, 10, 10);
+    TaskSchedule(TaskCreate(TelemetryTask), TELEMETRY_PERIOD, TELEMETRY_PERIOD);
+#if TRACE_ENABLE
+    TaskSchedule(TaskCreate(LogTrace), TRACE_PERIOD, TRACE_PERIOD);
+#endif
+#if BUS_CAPTURE
+    TaskSchedule(TaskCreate(LogCapture), CAPTURE_PERIOD, CAPTURE_PERIOD);
+#endif
     
     while(1) {
-        I2CProcess();
-        LcdProcess();
-        
-        if(IFS0bits.T1IF) {
-            IFS0bits.T1IF = 0;
-            TMR1 = 0;
-            
-            /* 1 ms process tasks are here */
-            LcdProcess1Ms();
-            
-            /* Do whatever you want here */
-            if(_module.time < 0xFFff) {           
-                _module.time++;
-    
-            }
-        }
-        
-        
-        
-        if(Ready() && startcall) {
-            startcall = 0;
-            Backlight();
-            Print("ABCDEFGHIJKLM");
-            SetCursor(0,1);
-            Print("NOPQRSTUVWXYZ");
-        }
+        SchedulerProcess();
     }
     
     return 0;
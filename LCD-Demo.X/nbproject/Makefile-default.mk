@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c i2cDriver.c lcdDriver.c utils.c
+SOURCEFILES_QUOTED_IF_SPACED=main.c i2cDriver.c lcdDriver.c utils.c ../Common/scheduler.c ../Common/trace.c ../Common/uartDriver.c ../Common/busCapture.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver.o ${OBJECTDIR}/lcdDriver.o ${OBJECTDIR}/utils.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/i2cDriver.o.d ${OBJECTDIR}/lcdDriver.o.d ${OBJECTDIR}/utils.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver.o ${OBJECTDIR}/lcdDriver.o ${OBJECTDIR}/utils.o ${OBJECTDIR}/_ext/2108356922/scheduler.o ${OBJECTDIR}/_ext/2108356922/trace.o ${OBJECTDIR}/_ext/2108356922/uartDriver.o ${OBJECTDIR}/_ext/2108356922/busCapture.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/i2cDriver.o.d ${OBJECTDIR}/lcdDriver.o.d ${OBJECTDIR}/utils.o.d ${OBJECTDIR}/_ext/2108356922/scheduler.o.d ${OBJECTDIR}/_ext/2108356922/trace.o.d ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d ${OBJECTDIR}/_ext/2108356922/busCapture.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver.o ${OBJECTDIR}/lcdDriver.o ${OBJECTDIR}/utils.o
+OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver.o ${OBJECTDIR}/lcdDriver.o ${OBJECTDIR}/utils.o ${OBJECTDIR}/_ext/2108356922/scheduler.o ${OBJECTDIR}/_ext/2108356922/trace.o ${OBJECTDIR}/_ext/2108356922/uartDriver.o ${OBJECTDIR}/_ext/2108356922/busCapture.o
 
 # Source Files
-SOURCEFILES=main.c i2cDriver.c lcdDriver.c utils.c
+SOURCEFILES=main.c i2cDriver.c lcdDriver.c utils.c ../Common/scheduler.c ../Common/trace.c ../Common/uartDriver.c ../Common/busCapture.c
 
 
 
@@ -123,6 +123,34 @@ ${OBJECTDIR}/utils.o: utils.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  utils.c  -o ${OBJECTDIR}/utils.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/utils.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/utils.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/2108356922/scheduler.o: ../Common/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/scheduler.c  -o ${OBJECTDIR}/_ext/2108356922/scheduler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/scheduler.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/scheduler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/trace.o: ../Common/trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/trace.c  -o ${OBJECTDIR}/_ext/2108356922/trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/trace.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/trace.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/uartDriver.o: ../Common/uartDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/uartDriver.c  -o ${OBJECTDIR}/_ext/2108356922/uartDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/busCapture.o: ../Common/busCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/busCapture.c  -o ${OBJECTDIR}/_ext/2108356922/busCapture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/busCapture.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/busCapture.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 else
 ${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}" 
@@ -152,6 +180,34 @@ ${OBJECTDIR}/utils.o: utils.c  nbproject/Makefile-${CND_CONF}.mk
 	${MP_CC} $(MP_EXTRA_CC_PRE)  utils.c  -o ${OBJECTDIR}/utils.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/utils.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
 	@${FIXDEPS} "${OBJECTDIR}/utils.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
 	
+${OBJECTDIR}/_ext/2108356922/scheduler.o: ../Common/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/scheduler.c  -o ${OBJECTDIR}/_ext/2108356922/scheduler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/scheduler.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/scheduler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/trace.o: ../Common/trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/trace.c  -o ${OBJECTDIR}/_ext/2108356922/trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/trace.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/trace.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/uartDriver.o: ../Common/uartDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/uartDriver.c  -o ${OBJECTDIR}/_ext/2108356922/uartDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/busCapture.o: ../Common/busCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/busCapture.c  -o ${OBJECTDIR}/_ext/2108356922/busCapture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/busCapture.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/busCapture.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
 endif
 
 # ------------------------------------------------------------------------------------
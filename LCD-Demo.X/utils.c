@@ -11,11 +11,12 @@
 #include "utils.h"
 
 void DelayMicroseconds(unsigned int usec) {
-    /* one mip is 1/10th of a microsecond */
+    /* Rounded up, so a short delay never comes out shorter than asked */
+    unsigned long passes = ((unsigned long) usec * (CLOCK_RATE / 1000) + 9999) / 10000;
     unsigned long i = 0;
     
-    /* 10 instructions per mip */
-    for(; i < (usec * MIPS); ++i) {
+    /* 10 instructions per pass */
+    for(; i < passes; ++i) {
         // 1 instruction to check
         // 1 instruction to increment
         // 8 more instructions inside bracket
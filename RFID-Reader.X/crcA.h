@@ -0,0 +1,53 @@
+
+#ifndef __CRC_A_H_
+#define	__CRC_A_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "mfrc522.h"
+
+#define CRC_A_SOFTWARE    0
+#define CRC_A_COPROCESSOR 1
+
+/*
+ * Pick the backend with -DCRC_A_BACKEND=... in the project macros.
+ *
+ * The coprocessor path costs a FIFO flush and write, five register writes
+ * to start CalcCRC, the IRQ handling and one window for both results, about
+ * 30 SPI bytes plus the frame itself. At SCK = Fcy / 2 each SPI byte is 16
+ * instruction cycles. SPI_BENCHMARK in main.c times CRC_A at 8 and 64 bytes
+ * with the backend that is built, so the table's cost per byte is the
+ * difference between the two over 56. Counted off its instructions the
+ * table loop comes to 12 cycles a byte, the PSV read included; that count
+ * has not been held against the benchmark log on hardware yet. Anything
+ * under 16 means the coprocessor loses per byte as well as on its fixed
+ * cost, so software wins at every frame length. Tools/crcTest puts the
+ * model's coprocessor at 24 cycles a byte once the DMA copy is counted.
+ * The coprocessor is only worth it if code space is tight, since the table
+ * costs 512 bytes of flash.
+ */
+#ifndef CRC_A_BACKEND
+#define CRC_A_BACKEND CRC_A_SOFTWARE
+#endif
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /*
+     * CRC_A per ISO 14443-3, low byte goes out on air first. StartCrcA
+     * returns -1 if it couldn't be started, otherwise CrcAProcess reports
+     * CommandBusy until crc holds the result and CommandDone. Anything else
+     * means there is no result and crc is left alone.
+     * The software backend is done inside StartCrcA. The coprocessor runs
+     * CalcCRC on rdr's command engine, so rdr must have no command in flight
+     * and CrcAProcess is called from the main loop like CommandProcess.
+     */
+    int StartCrcA(mfrc522_t *rdr, const uint8_t *dat, unsigned int len, uint16_t *crc);
+    enum commandStatus CrcAProcess(mfrc522_t *rdr, uint16_t *crc);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,21 @@
+#ifndef __GLOBAL_H_
+#define	__GLOBAL_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.  
+
+/*
+ * Instruction clock. FNOSC = FRC with no PLL, so this is the nominal
+ * 7.37 MHz FRC over 2. Change it with FNOSC if the PLL is ever switched on.
+ */
+#define CLOCK_RATE (3685000)
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,475 @@
+/*
+ * File:   iso14443a.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 1:30 PM
+ */
+
+
+#include "xc.h"
+#include "mfrc522.h"
+#include "iso14443a.h"
+#include "../Common/scheduler.h"
+#include "crcA.h"
+
+// PICC commands
+#define PICC_REQA    0x26
+#define PICC_WUPA    0x52
+#define PICC_SEL_CL1 0x93
+#define PICC_SEL_CL2 0x95
+#define PICC_SEL_CL3 0x97
+#define PICC_HLTA    0x50
+#define PICC_CT      0x88 // Cascade tag, UID continues at the next level
+
+// ErrorReg bits
+#define PROTOCOL_ERR 0x01
+#define PARITY_ERR   0x02
+#define CRC_ERR      0x04
+#define COLL_ERR     0x08
+#define BUFFER_OVFL  0x10
+
+#define RF_TIMEOUT_TICKS 40       // Reader timer runs at 40 kHz, so this is 1 ms
+#define COMMAND_TIMEOUT 5         // ms, backstop in case the reader timer never fires
+#define DEFAULT_POLL_INTERVAL 50  // ms
+
+/* TModeReg through TReloadRegL */
+static const uint8_t timerConfig[] = {
+    0x80,                     // TAuto, timer starts at the end of every transmission
+    0xA9,                     // 13.56 MHz / (2 * 169 + 1) = 40 kHz
+    RF_TIMEOUT_TICKS >> 8,
+    RF_TIMEOUT_TICKS & 0xFF,
+};
+
+static const uint8_t selectCodes[] = { PICC_SEL_CL1, PICC_SEL_CL2, PICC_SEL_CL3 };
+
+/****** Low level frame exchange on top of the command engine *******/
+
+/*
+ * framing is BitFramingReg without StartSend, RxAlign in the high nibble,
+ * TxLastBits in the low. It is written together with StartSend, so it takes
+ * effect right as the frame goes out.
+ */
+void StartTransceive(cardReader_t *cr, uint8_t *dat, unsigned int len, uint8_t framing)
+{
+    StartFifoCommand(cr->rdr, CMD_TRANSCEIVE, dat, len, framing, RX_IRQ | TIMER_IRQ, 0, COMMAND_TIMEOUT);
+}
+
+/*
+ * Returns bytes received, -1 when nothing answered, -2 on a collision, -3 on
+ * any other error. Whatever did arrive is left in rx either way.
+ */
+int FinishTransceive(cardReader_t *cr, enum commandStatus cmd)
+{
+    uint8_t err;
+
+    cr->rxLen = 0;
+    if(cmd == CommandTimeout || !(CommandIrq(cr->rdr) & RX_IRQ)) return -1;
+
+    err = CommandError(cr->rdr);
+    cr->rxLen = GetFifo(cr->rdr, cr->rx, FIFO_SIZE);
+    if(err & COLL_ERR) return -2;
+    if(err & (PROTOCOL_ERR | PARITY_ERR | BUFFER_OVFL)) return -3;
+    return cr->rxLen;
+}
+
+/****** Card pipeline steps *******/
+
+void SendRequest(cardReader_t *cr, uint8_t req)
+{
+    cr->buf[0] = req;
+    StartTransceive(cr, cr->buf, 1, 0x07); // Short frame, 7 bits
+    cr->st = CardRequest;
+}
+
+void SendAnticoll(cardReader_t *cr)
+{
+    uint8_t bytes = cr->knownBits / 8;
+    uint8_t bits = cr->knownBits % 8;
+
+    cr->buf[0] = selectCodes[cr->level];
+    cr->buf[1] = ((2 + bytes) << 4) | bits; // NVB
+    /* RxAlign lines the answer up right where our known bits stop */
+    StartTransceive(cr, cr->buf, 2 + bytes + (bits ? 1 : 0), (bits << 4) | bits);
+    cr->st = CardAnticoll;
+}
+
+void CheckFinished(cardReader_t *cr, int present)
+{
+    cr->checkPresent = present;
+    cr->checkDone = 1;
+}
+
+/* Without a CRC there is no frame, and a check that was running counts the tag as gone */
+void CrcFailed(cardReader_t *cr)
+{
+    if(cr->next == CardReselect) CheckFinished(cr, 0);
+    cr->st = CardPollWait;
+}
+
+/* Appends the CRC_A to the frame in buf once it is in and sends it, moving on to next */
+void FrameCrcProcess(cardReader_t *cr)
+{
+    enum commandStatus cmd = CrcAProcess(cr->rdr, &cr->crc);
+
+    if(cmd == CommandBusy) return;
+    if(cmd != CommandDone) {
+        CrcFailed(cr);
+        return;
+    }
+    cr->buf[cr->frameLen] = cr->crc & 0xFF;
+    cr->buf[cr->frameLen + 1] = cr->crc >> 8;
+    StartTransceive(cr, cr->buf, cr->frameLen + 2, 0);
+    cr->st = cr->next;
+}
+
+void SendWithCrc(cardReader_t *cr, uint8_t len, enum cardStates next)
+{
+    cr->frameLen = len;
+    cr->next = next;
+    cr->st = CardFrameCrc;
+    if(StartCrcA(cr->rdr, cr->buf, len, &cr->crc) < 0) {
+        CrcFailed(cr);
+        return;
+    }
+    /* The software CRC is already done, so the frame goes out on this pass */
+    FrameCrcProcess(cr);
+}
+
+/* next is CardSelect during a poll and CardReselect during a check */
+void SendSelect(cardReader_t *cr, enum cardStates next)
+{
+    cr->buf[0] = selectCodes[cr->level];
+    cr->buf[1] = 0x70; // NVB, all 40 bits known
+    SendWithCrc(cr, 7, next);
+}
+
+void SendHalt(cardReader_t *cr)
+{
+    cr->buf[0] = PICC_HLTA;
+    cr->buf[1] = 0x00;
+    SendWithCrc(cr, 2, CardHalt);
+}
+
+/* Merges an anticollision answer into buf, returns 1 once the level is fully known */
+int AnticollReply(cardReader_t *cr, int ret)
+{
+    uint8_t cnt = cr->rxLen;
+    uint8_t bytes = cr->knownBits / 8;
+    uint8_t bits = cr->knownBits % 8;
+    uint8_t index = 2 + bytes;
+    uint8_t mask = (1 << bits) - 1;
+    uint8_t coll;
+    int i = 0;
+
+    if(ret == -1 || ret == -3) return -1;
+
+    /* First byte back shares its low bits with the ones we sent */
+    if(cnt > 0 && bits) {
+        cr->rx[0] = (cr->buf[index] & mask) | (cr->rx[0] & ~mask);
+    }
+    for(; i < cnt && index + i < 7; ++i) {
+        cr->buf[index + i] = cr->rx[i];
+    }
+
+    if(ret != -2) {
+        if(index + cnt < 7) return -1;
+        cr->knownBits = 40;
+        /* BCC is the XOR of the four UID bytes */
+        if((cr->buf[2] ^ cr->buf[3] ^ cr->buf[4] ^ cr->buf[5]) != cr->buf[6]) return -1;
+        return 1;
+    }
+
+    coll = ReadRegister(cr->rdr, COLL_REG);
+    if(coll & 0x20) return -1; // CollPosNotValid
+    coll &= 0x1F;
+    if(coll == 0) coll = 32;
+    if(coll <= cr->knownBits) return -1;
+
+    /* Pick the card that sent a 1 at the collision and go again */
+    cr->knownBits = coll;
+    cr->buf[2 + (coll - 1) / 8] |= 1 << ((coll - 1) % 8);
+    return 0;
+}
+
+/* Returns 1 when the UID is complete, 0 to go on to the next cascade level */
+int SelectReply(cardReader_t *cr, int sak)
+{
+    int i = 0;
+
+    if(sak < 0) return -1;
+
+    /* Cascade tag means only three UID bytes at this level */
+    i = (cr->buf[2] == PICC_CT) ? 1 : 0;
+    for(; i < 4 && cr->uidLen < UID_SIZE; ++i) {
+        cr->uid[cr->uidLen++] = cr->buf[2 + i];
+    }
+
+    if((sak & 0x04) && cr->level < 2) {
+        cr->level++;
+        cr->knownBits = 0;
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Loads this level's part of a known UID into buf, the same way anticollision
+ * would have left it. A 4 byte UID is one level, 7 is two and 10 is three,
+ * with every level but the last giving up a byte to the cascade tag.
+ */
+void LoadKnownLevel(cardReader_t *cr)
+{
+    uint8_t levels = (cr->checkLen == 4) ? 1 : (cr->checkLen == 7) ? 2 : 3;
+    const uint8_t *part = cr->check + 3 * cr->level;
+    int i = 0;
+
+    if(cr->level < levels - 1) {
+        cr->buf[2] = PICC_CT;
+        for(; i < 3; ++i) cr->buf[3 + i] = part[i];
+    } else {
+        for(; i < 4; ++i) cr->buf[2 + i] = part[i];
+    }
+    cr->buf[6] = cr->buf[2] ^ cr->buf[3] ^ cr->buf[4] ^ cr->buf[5];
+}
+
+/* Returns 1 once the last level answered, 0 for another level, -1 if the tag is gone */
+int CheckReply(cardReader_t *cr, int sak)
+{
+    int last = cr->buf[2] != PICC_CT;
+
+    if(sak < 0) return -1;
+    /* Cascade bit has to agree with where we think the UID ends */
+    if(((sak & 0x04) != 0) == last) return -1;
+    if(last) return 1;
+    cr->level++;
+    return 0;
+}
+
+void CardFound(cardReader_t *cr)
+{
+    int i = 0;
+    unsigned int latency = Millis() - cr->pollStart;
+
+    for(; i < cr->uidLen; ++i) {
+        cr->card[i] = cr->uid[i];
+    }
+    cr->cardLen = cr->uidLen;
+    cr->cardReady = 1;
+
+    cr->stats.reads++;
+    cr->windowReads++;
+    cr->stats.lastLatency = latency;
+    if(latency > cr->stats.maxLatency) cr->stats.maxLatency = latency;
+}
+
+/* sak is -1 when the select answer was no good */
+void SelectDone(cardReader_t *cr, int sak)
+{
+    int ret = SelectReply(cr, sak);
+
+    if(ret < 0) cr->st = CardPollWait;
+    else if(ret == 0) SendAnticoll(cr);
+    else {
+        CardFound(cr);
+        SendHalt(cr);
+    }
+}
+
+void CheckDone(cardReader_t *cr, int sak)
+{
+    int ret = CheckReply(cr, sak);
+
+    if(ret < 0) {
+        /* Anyone woken up but not selected drops back on their own */
+        CheckFinished(cr, 0);
+        cr->st = CardPollWait;
+    } else if(ret == 0) {
+        LoadKnownLevel(cr);
+        SendSelect(cr, CardReselect);
+    } else {
+        CheckFinished(cr, 1);
+        SendHalt(cr);
+    }
+}
+
+/* Hands the SAK to whichever of the two select steps sent for it, once its CRC_A checks out */
+void AnswerCrcProcess(cardReader_t *cr)
+{
+    enum commandStatus cmd = CrcAProcess(cr->rdr, &cr->crc);
+    int sak = -1;
+
+    if(cmd == CommandBusy) return;
+    if(cmd == CommandDone && cr->rx[1] == (cr->crc & 0xFF) && cr->rx[2] == (cr->crc >> 8)) {
+        sak = cr->rx[0];
+    }
+    if(cr->next == CardSelect) SelectDone(cr, sak);
+    else CheckDone(cr, sak);
+}
+
+/* A select answer is the SAK and its CRC_A, cnt is what FinishTransceive returned */
+void SelectAnswer(cardReader_t *cr, int cnt, enum cardStates from)
+{
+    cr->next = from;
+    cr->st = CardAnswerCrc;
+    if(cnt != 3 || StartCrcA(cr->rdr, cr->rx, 1, &cr->crc) < 0) {
+        if(from == CardSelect) SelectDone(cr, -1);
+        else CheckDone(cr, -1);
+        return;
+    }
+    AnswerCrcProcess(cr);
+}
+
+/****** High level API *******/
+
+void CardInit(cardReader_t *cr, mfrc522_t *rdr)
+{
+    cr->rdr = rdr;
+
+    /* Everything here stays put between polls, so it is only written once */
+    WriteRegisters(cr->rdr, T_MODE_REG, timerConfig, sizeof(timerConfig));
+    WriteRegister(cr->rdr, TX_ASK_REG, 0x40);      // 100% ASK
+    WriteRegister(cr->rdr, MODE_REG, 0x3D);        // CRC preset 0x6363 for CRC_A
+    WriteRegister(cr->rdr, COLL_REG, 0x00);        // Clear bits received after a collision
+    WriteRegister(cr->rdr, TX_CONTROL_REG, ReadRegister(cr->rdr, TX_CONTROL_REG) | 0x03); // Antenna on
+
+    cr->pollInterval = DEFAULT_POLL_INTERVAL;
+    cr->pollStart = Millis();
+    cr->windowStart = cr->pollStart;
+    cr->st = CardPollWait;
+}
+
+void CardProcess(cardReader_t *cr)
+{
+    enum commandStatus cmd;
+    int ret;
+
+    /* Every reader shares the bus, so let a FIFO transfer finish rather than queue up behind it */
+    if(SPIBusy()) return;
+
+    if((unsigned int)(Millis() - cr->windowStart) >= 1000) {
+        cr->windowStart += 1000;
+        cr->stats.readRate = cr->windowReads;
+        cr->windowReads = 0;
+    }
+
+    switch(cr->st) {
+        case CardPollWait:
+            if((unsigned int)(Millis() - cr->pollStart) < cr->pollInterval) break;
+            cr->pollStart = Millis();
+            cr->stats.polls++;
+            SendRequest(cr, cr->wakeAll ? PICC_WUPA : PICC_REQA);
+            cr->wakeAll = 0;
+            break;
+        case CardRequest:
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            /* Any ATQA at all, even a garbled one from several cards, means someone is there */
+            if(FinishTransceive(cr, cmd) == -1) {
+                cr->st = CardPollWait;
+                break;
+            }
+            cr->level = 0;
+            cr->knownBits = 0;
+            cr->uidLen = 0;
+            SendAnticoll(cr);
+            break;
+        case CardAnticoll:
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            ret = AnticollReply(cr, FinishTransceive(cr, cmd));
+            if(ret < 0) cr->st = CardPollWait;
+            else if(ret == 0) SendAnticoll(cr);
+            else SendSelect(cr, CardSelect);
+            break;
+        case CardSelect:
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            SelectAnswer(cr, FinishTransceive(cr, cmd), CardSelect);
+            break;
+        case CardWakeup:
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            /* Other tags may wake up too and garble the ATQA, that's fine */
+            if(FinishTransceive(cr, cmd) == -1) {
+                CheckFinished(cr, 0);
+                cr->st = CardPollWait;
+                break;
+            }
+            cr->level = 0;
+            LoadKnownLevel(cr);
+            SendSelect(cr, CardReselect);
+            break;
+        case CardReselect:
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            SelectAnswer(cr, FinishTransceive(cr, cmd), CardReselect);
+            break;
+        case CardFrameCrc:
+            FrameCrcProcess(cr);
+            break;
+        case CardAnswerCrc:
+            AnswerCrcProcess(cr);
+            break;
+        case CardHalt:
+            /* A halted card never answers, so the timeout is the good case */
+            cmd = CommandProcess(cr->rdr);
+            if(cmd == CommandBusy) break;
+            cr->st = CardPollWait;
+            break;
+    }
+}
+
+int CardIdle(cardReader_t *cr)
+{
+    return cr->st == CardPollWait;
+}
+
+void SetPollInterval(cardReader_t *cr, unsigned int ms)
+{
+    cr->pollInterval = ms;
+}
+
+/* Returns the UID length when a new card was read since the last call, 0 otherwise */
+int GetCardUid(cardReader_t *cr, uint8_t *uid)
+{
+    int i = 0;
+    if(!cr->cardReady) return 0;
+    for(; i < cr->cardLen; ++i) {
+        uid[i] = cr->card[i];
+    }
+    cr->cardReady = 0;
+    return cr->cardLen;
+}
+
+void CardWakeAll(cardReader_t *cr)
+{
+    cr->wakeAll = 1;
+}
+
+/* Returns 0 when started, -1 if the reader is in the middle of something */
+int CardCheck(cardReader_t *cr, const uint8_t *uid, uint8_t len)
+{
+    if(cr->st != CardPollWait) return -1;
+    if(len != 4 && len != 7 && len != 10) return -1;
+
+    cr->check = uid;
+    cr->checkLen = len;
+    cr->checkDone = 0;
+    /* WUPA rather than REQA, the tag was halted after the last time we saw it */
+    SendRequest(cr, PICC_WUPA);
+    cr->st = CardWakeup;
+    return 0;
+}
+
+/* Returns 1 if the tag answered, 0 if it didn't, -1 while the check is still running */
+int GetCheckResult(cardReader_t *cr)
+{
+    if(!cr->checkDone) return -1;
+    cr->checkDone = 0;
+    return cr->checkPresent;
+}
+
+void GetCardStats(cardReader_t *cr, cardStats_t *stats)
+{
+    *stats = cr->stats;
+}
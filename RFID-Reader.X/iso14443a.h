@@ -0,0 +1,94 @@
+
+#ifndef __ISO14443A_H_
+#define	__ISO14443A_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "mfrc522.h"
+
+#define UID_SIZE 10
+
+typedef struct {
+    unsigned long polls;
+    unsigned long reads;
+    unsigned int readRate;    // Tags read in the last full second
+    unsigned int lastLatency; // ms from the start of a poll to a selected UID
+    unsigned int maxLatency;
+} cardStats_t;
+
+enum cardStates {
+    CardPollWait,
+    CardRequest,
+    CardAnticoll,
+    CardSelect,
+    CardHalt,
+    CardWakeup,
+    CardReselect,
+    CardFrameCrc,  // Waiting on the CRC_A for the frame in buf, then on to next
+    CardAnswerCrc, // Waiting on the CRC_A of a select answer, then back to next
+};
+
+/* Card pipeline state for one reader */
+typedef struct {
+    mfrc522_t *rdr;
+
+    enum cardStates st;
+
+    uint8_t level;     // Cascade level being resolved
+    uint8_t knownBits; // Bits of this level's UID CLn already resolved
+    uint8_t buf[9];    // SEL, NVB, UID CLn, BCC, CRC_A
+    uint8_t rx[FIFO_SIZE];
+    uint8_t rxLen;
+
+    enum cardStates next; // Where a CRC_A wait goes once it is done
+    uint8_t frameLen;     // Frame length in buf without its CRC_A
+    uint16_t crc;
+
+    uint8_t uid[UID_SIZE];
+    uint8_t uidLen;
+    uint8_t card[UID_SIZE];
+    uint8_t cardLen;
+
+    const uint8_t *check; // UID being re-selected by CardCheck
+    uint8_t checkLen;
+
+    unsigned int pollInterval;
+    unsigned int pollStart;
+    unsigned int windowStart;
+    unsigned int windowReads;
+
+    cardStats_t stats;
+
+    unsigned cardReady : 1;
+    unsigned checkDone : 1;
+    unsigned checkPresent : 1;
+    unsigned wakeAll : 1;
+} cardReader_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void CardInit(cardReader_t *cr, mfrc522_t *rdr);
+    void CardProcess(cardReader_t *cr);
+    int CardIdle(cardReader_t *cr);
+
+    void SetPollInterval(cardReader_t *cr, unsigned int ms);
+    int GetCardUid(cardReader_t *cr, uint8_t *uid);
+
+    /* Next poll wakes halted tags too, so tags we stopped tracking get read again */
+    void CardWakeAll(cardReader_t *cr);
+    /*
+     * Checks whether a tag we already know is still in the field, by waking
+     * it and selecting it straight by UID, then halting it again. uid has to
+     * stay put until GetCheckResult stops returning -1.
+     */
+    int CardCheck(cardReader_t *cr, const uint8_t *uid, uint8_t len);
+    int GetCheckResult(cardReader_t *cr);
+    void GetCardStats(cardReader_t *cr, cardStats_t *stats);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -7,6 +7,17 @@
 
 
 #include "xc.h"
+#include "spiDriver.h"
+#include "mfrc522.h"
+#include "global.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
+#include "../Common/uartDriver.h"
+#include "../Common/busCapture.h"
+#include "iso14443a.h"
+#include "random.h"
+#include "tagTracker.h"
+#include "crcA.h"
 
 #pragma config FNOSC = FRC
 #pragma config POSCMD = NONE
@@ -40,175 +51,270 @@ void InitClock()
 }
 #endif
 
-#define GENERATE_RANDOM (0b0010)
-#define MEM             (0b0001)
+/* Set to 1 to time the SPI paths at startup, see SpiBenchmark */
+#ifndef SPI_BENCHMARK
+#define SPI_BENCHMARK 0
+#endif
+#define BENCH_PASSES 2000
+#define BENCH_ACCESSES 16
 
+/* Number of readers fitted, up to MAX_READERS */
+#define READER_COUNT 2
 
-/**
- *  SPI Pin assignments
- * MISO - RP15 (26)
- * MOSI - RP14 (25)
- * CLK  - RP13 (24)
- */
+#define DICE_PERIOD 100 // ms between rolls
+#define LED_FLASH 20    // ms
+#define LOG_BAUD 460800
+#define TELEMETRY_PERIOD 1000 // ms
+#define TRACE_PERIOD 10       // ms
+#define CAPTURE_PERIOD 10     // ms
 
 /**
- *  RPN Codes
- * MISO1 RPINR20
- * MOSI1 00111
- * CLK1  01000
+ *  Reader Pin assignments
+ * Reader 0 - CS RB12 (23), IRQ RB11 (22) CN15
+ * Reader 1 - CS RB10 (21), IRQ RB4  (11) CN1
+ * Reader 2 - CS RB2  (6),  IRQ RB3  (7)  CN7
+ * Reader 3 - CS RA2  (9),  IRQ RA4  (12) CN0
  */
+static const readerPins_t readerPins[MAX_READERS] = {
+    { &TRISB, &LATB, 1 << 12, &TRISB, &PORTB, 1 << 11, &CNEN1, 1 << 15 },
+    { &TRISB, &LATB, 1 << 10, &TRISB, &PORTB, 1 << 4,  &CNEN1, 1 << 1 },
+    { &TRISB, &LATB, 1 << 2,  &TRISB, &PORTB, 1 << 3,  &CNEN1, 1 << 7 },
+    { &TRISA, &LATA, 1 << 2,  &TRISA, &PORTA, 1 << 4,  &CNEN1, 1 << 0 },
+};
 
-/**
- * RFID chip documentation:
- * MSB-order
- * Data provided on falling edge, stable on rising edge
- * First byte is length of message
- */
+static struct {
+    mfrc522_t readers[READER_COUNT];
+    cardReader_t cards[READER_COUNT];
+    tagTracker_t trackers[READER_COUNT];
 
-void StartTransaction()
-{
-    PORTBbits.RB12 = 0;
-}
-void EndTransaction()
-{
-    PORTBbits.RB12 = 1;
-}
+    int readerTask;
+    int ledOffTask;
+} _module;
 
-void SendSPIByte(uint8_t b)
+/* Tags read in the last second across every reader */
+unsigned int ReadRate()
 {
-    while(SPI1STATbits.SPITBF) ; // Wait until we can write
-    /* Dummy read to clear SPIRBF flag */
-    SPI1BUF;
-    SPI1BUF = b;
-    while(!SPI1STATbits.SPIRBF) ; // Wait until we clock out the data
+    cardStats_t stats;
+    unsigned int rate = 0;
+    int i = 0;
+    for(; i < READER_COUNT; ++i) {
+        GetCardStats(&_module.cards[i], &stats);
+        rate += stats.readRate;
+    }
+    return rate;
 }
 
-uint8_t ReadSPIByte()
+/* Every arrival and departure goes out as a LOG_UID record */
+void LogTagEvent(int reader, tagEvent_t *event)
 {
-    return SPI1BUF;
+    uint8_t payload[UID_SIZE + 1];
+    int i = 0;
+
+    payload[0] = reader | (event->type == TagDepart ? 0x80 : 0x00);
+    for(; i < event->uidLen; ++i) {
+        payload[i + 1] = event->uid[i];
+    }
+    LogRecord(LOG_UID, payload, event->uidLen + 1);
 }
 
-uint8_t SendReceiveSPIByte(uint8_t b)
+/*
+ * Every step only starts or checks on a command, so while one reader waits
+ * for a tag to answer the others keep getting serviced. Runs every ms for the
+ * poll and timeout timing, and right away whenever a reader raises its IRQ.
+ */
+void ReaderTask()
 {
-    SendSPIByte(b);
-    return ReadSPIByte();
+    tagEvent_t event;
+    int i = 0;
+
+    for(; i < READER_COUNT; ++i) {
+        if(i == 0 && RandomBusy()) continue;
+        TrackerProcess(&_module.trackers[i]);
+        /* Only arrivals and departures come out, a tag left sitting there is quiet */
+        while(GetTagEvent(&_module.trackers[i], &event)) {
+            if(event.type == TagArrive) PORTAbits.RA1 = !PORTAbits.RA1;
+            LogTagEvent(i, &event);
+        }
+    }
+    if(CardIdle(&_module.cards[0])) RandomProcess();
 }
 
-void WriteRegister(uint8_t b)
+void LedOff()
 {
-    SendSPIByte(0x00 | (b << 1));
+    PORTAbits.RA0 = 0;
 }
 
-uint8_t ReadRegister(uint8_t b)
+/* Flashes RA0 on a one in six roll */
+void DiceTask()
 {
-    return SendReceiveSPIByte(0x80 | (b << 1));
+    unsigned int random;
+
+    if(!RandomBelow(6, &random)) return;
+    if(random != 0) return;
+    PORTAbits.RA0 = 1;
+    TaskSchedule(_module.ledOffTask, LED_FLASH, 0);
 }
 
-void ReadData(uint8_t *dat, unsigned int count)
+/* CPU load, tags read and SPI bytes in the last second, then dropped log writes */
+void TelemetryTask()
 {
-    int i = 0;
-    for(i = 0; i < count; ++i)
-    {
-        dat[i] = ReadRegister(dat[i]);
-    }
+    static unsigned long lastBytes = 0;
+    uint16_t counters[4];
+    unsigned long bytes = SPIBytes();
+
+    counters[0] = CpuLoad();
+    counters[1] = ReadRate();
+    counters[2] = bytes - lastBytes;
+    counters[3] = LogDropped();
+    lastBytes = bytes;
+    LogRecord(LOG_COUNTERS, (uint8_t *) counters, sizeof(counters));
 }
 
-void InitializeSPIDriver()
+#if SPI_BENCHMARK
+/* SCK settings register access is timed at, each rounded down to what the prescalers give */
+static const unsigned long benchClocks[] = { 250000, 500000, 1000000, 2000000 };
+#define BENCH_CLOCKS (sizeof(benchClocks) / sizeof(benchClocks[0]))
+
+/* Frame lengths CRC_A is timed at, the slope between them is its cost per byte */
+static const unsigned int benchCrcLens[] = { 8, 64 };
+#define BENCH_CRC_LENS (sizeof(benchCrcLens) / sizeof(benchCrcLens[0]))
+
+static volatile uint8_t _benchDone;
+
+void BenchDone(uint8_t *rx)
 {
-    RPINR20bits.SDI1R = 15;     // RP15 (RB15)
-    RPOR7bits.RP14R = 0b00111;  // RP14 (RB14)
-    RPOR6bits.RP13R = 0b01000;  // RP13 (RB13)
-    TRISBbits.TRISB12 = 0;      // RP12 (RB12)
-    PORTBbits.RB12 = 1; /* Keep it high */
-    
-    SPI1STAT = 0;
-    
-    /* Actual SPI register configuration */
-    SPI1CON1bits.MODE16 = 0x0; // Byte-communication
-    SPI1CON1bits.CKE = 0x1;    // Data changes on falling edge
-    SPI1CON1bits.CKP = 0x0;    // Active state is high
-    SPI1CON1bits.MSTEN = 0x1;  // Master-Mode
-    SPI1CON1bits.SPRE = 0b000;
-    SPI1CON1bits.PPRE = 0b11;
-    
-    SPI1STATbits.SPIEN = 1;
+    _benchDone = 1;
 }
 
-void WaitUntilNopCommand()
+/* Same loop both times, so the passes it gets through can be compared */
+unsigned long CountPasses()
 {
-    StartTransaction();
-    ReadRegister(0x01);
-    while((ReadRegister(0x01) & 0x0F) != 0x00) ;
-    SendSPIByte(0); // End read
-    EndTransaction();
+    unsigned long passes = 0;
+    while(!_benchDone && passes < BENCH_PASSES) passes++;
+    return passes;
 }
 
-unsigned int GetRandomFromRFID()
+/*
+ * CPU cycles for a 64 byte FIFO read, the old blocking way and over DMA,
+ * logged as LOG_COUNTERS at startup. The DMA figure is what the transfer
+ * takes away from a counting loop left running next to it, so it covers
+ * starting the transfer and the completion interrupt.
+ *
+ * Then one register read at each of benchClocks, driver code included,
+ * logged as a second LOG_COUNTERS of SCK in kHz and cycles per read pairs.
+ *
+ * Last a CRC_A at each of benchCrcLens with whichever backend is built,
+ * logged as a third LOG_COUNTERS of length and cycles pairs. crcA.h works
+ * out where the coprocessor would pay off from these.
+ */
+void SpiBenchmark(mfrc522_t *rdr)
 {
-    /* Flush FIFO Buffer */
-    StartTransaction();
-    WriteRegister(0x0A);
-    SendSPIByte(0x80);
-    EndTransaction();
-    WaitUntilNopCommand();
-    
-    /* Set the command for random */
-    StartTransaction();
-    WriteRegister(0x01);
-    SendSPIByte(0x00 | GENERATE_RANDOM); /* Just generate random */
-    EndTransaction();
-    WaitUntilNopCommand();
-    
-    /* Set the command for mem */
-    StartTransaction();
-    WriteRegister(0x01);
-    SendSPIByte(0x00 | MEM); /* Just move internal buffer to FIFO */
-    EndTransaction();
-    WaitUntilNopCommand();
-    
-    /* Read FIFO */
-    StartTransaction();
-    ReadRegister(0x0A); // Prep read
-    while(ReadRegister(0x0A) != 25) ; // Read
-    SendSPIByte(0); // End read
-    EndTransaction();
-    
-    uint8_t dat[11];
-    int i = 0;
-    for(i = 0 ; i < 10; ++i)
-    {
-        dat[i] = 0x09;
+    uint8_t tx[FIFO_SIZE + 1];
+    uint8_t rx[FIFO_SIZE + 1];
+    uint16_t counters[2];
+    uint16_t latency[2 * BENCH_CLOCKS];
+    uint16_t crcCycles[2 * BENCH_CRC_LENS];
+    uint16_t crc;
+    spiDevice_t saved = rdr->spi;
+    unsigned long start;
+    unsigned long calibration;
+    unsigned long passes;
+    unsigned int i = 0;
+    unsigned int n;
+
+    for(; i < FIFO_SIZE; ++i) {
+        tx[i] = READ_ADDRESS(FIFO_DATA_REG);
+    }
+    tx[FIFO_SIZE] = 0x00;
+
+    /* Before, every byte waited out on SPIRBF */
+    start = Cycles();
+    StartTransaction(&rdr->spi);
+    for(i = 0; i <= FIFO_SIZE; ++i) {
+        rx[i] = SendReceiveSPIByte(tx[i]);
     }
-    dat[10] = 0x00; /* Null terminate transaction */
-    
-    StartTransaction();
-    ReadData(dat, 11);
-    EndTransaction();
-    
-    /* Flush FIFO Buffer */
-    StartTransaction();
-    WriteRegister(0x0A);
-    SendSPIByte(0x80);
     EndTransaction();
-    WaitUntilNopCommand();
-    
-    /* Just return the first two bytes appended together */
-    unsigned int ret = ((unsigned int) dat[3] << 8) | dat[4];
-    return ret;
+    counters[0] = Cycles() - start;
+
+    /* Cycles the counting loop takes with nothing else going on */
+    _benchDone = 0;
+    start = Cycles();
+    CountPasses();
+    calibration = Cycles() - start;
+
+    start = Cycles();
+    SPITransfer(&rdr->spi, tx, rx, FIFO_SIZE + 1, BenchDone);
+    passes = CountPasses();
+    counters[1] = Cycles() - start - passes * calibration / BENCH_PASSES;
+
+    LogRecord(LOG_COUNTERS, (uint8_t *) counters, sizeof(counters));
+
+    /* ComIrqReg is never cached, so every read goes out on the bus */
+    for(i = 0; i < BENCH_CLOCKS; ++i) {
+        latency[2 * i] = SPIConfigureDevice(&rdr->spi, CLOCK_RATE, benchClocks[i], 0, // MFRC522 is mode 0
+                saved.csPort, saved.csMask) / 1000;
+        start = Cycles();
+        for(n = 0; n < BENCH_ACCESSES; ++n) {
+            ReadRegister(rdr, COM_IRQ_REG);
+        }
+        latency[2 * i + 1] = (Cycles() - start) / BENCH_ACCESSES;
+    }
+    rdr->spi = saved;
+
+    LogRecord(LOG_COUNTERS, (uint8_t *) latency, sizeof(latency));
+
+    /* Nothing else runs yet, so the coprocessor is simply waited out */
+    for(i = 0; i < BENCH_CRC_LENS; ++i) {
+        crcCycles[2 * i] = benchCrcLens[i];
+        start = Cycles();
+        if(StartCrcA(rdr, tx, benchCrcLens[i], &crc) == 0) {
+            while(CrcAProcess(rdr, &crc) == CommandBusy) ;
+        }
+        crcCycles[2 * i + 1] = Cycles() - start;
+    }
+
+    LogRecord(LOG_COUNTERS, (uint8_t *) crcCycles, sizeof(crcCycles));
 }
+#endif
 
 int main(void) {
     int i;
+    AD1PCFGL = 0xFFFF; // No analog inputs, every pin is digital
+    InitScheduler(CLOCK_RATE);
+    InitTrace();
+    InitUART(CLOCK_RATE, LOG_BAUD);
     InitializeSPIDriver();
+    for(i = 0; i < READER_COUNT; ++i) {
+        InitReader(&_module.readers[i], &readerPins[i]);
+        CardInit(&_module.cards[i], &_module.readers[i]);
+        TrackerInit(&_module.trackers[i], &_module.cards[i]);
+    }
+    /* Pool refills from reader 0 between its own polls */
+    InitRandom(&_module.readers[0]);
+#if SPI_BENCHMARK
+    SpiBenchmark(&_module.readers[0]);
+#endif
+    
+    TRISAbits.TRISA0 = 0;
+    TRISAbits.TRISA1 = 0;
+    
+    _module.readerTask = TaskCreate(ReaderTask);
+    TaskSchedule(_module.readerTask, 1, 1);
+    SetIrqTask(_module.readerTask);
+    
+    _module.ledOffTask = TaskCreate(LedOff);
+    TaskSchedule(TaskCreate(DiceTask), DICE_PERIOD, DICE_PERIOD);
+    TaskSchedule(TaskCreate(TelemetryTask), TELEMETRY_PERIOD, TELEMETRY_PERIOD);
+#if TRACE_ENABLE
+    TaskSchedule(TaskCreate(LogTrace), TRACE_PERIOD, TRACE_PERIOD);
+#endif
+#if BUS_CAPTURE
+    TaskSchedule(TaskCreate(LogCapture), CAPTURE_PERIOD, CAPTURE_PERIOD);
+#endif
     
-    TRISA = 0x00;
-    unsigned int random = 0;
     while(1)
     {
-        PORTAbits.RA0 = 1;
-        for(i = 0; i < 0x7FFF; ++i) ;
-        PORTAbits.RA0 = 0;
-        do { random = GetRandomFromRFID(); } while(random > 0x5);
+        SchedulerProcess();
     }
     
     return 0;
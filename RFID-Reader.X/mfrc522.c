@@ -0,0 +1,516 @@
+/*
+ * File:   mfrc522.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 10:15 AM
+ */
+
+
+#include "xc.h"
+#include "spiDriver.h"
+#include "mfrc522.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
+#include "global.h"
+
+#define SPI_CLOCK 10000000 // Fastest the MFRC522 takes
+#define SPI_MODE  0
+#define TRANSFER_TIMEOUT 2 // ms for a FIFO transfer, a full one takes well under one
+
+/**
+ * RFID chip documentation:
+ * MSB-order
+ * Data provided on falling edge, stable on rising edge
+ * Reads are pipelined: every address byte clocks out the data of the one
+ * sent before it, so N reads take N+1 bytes in one chip-select window.
+ * Writes take one address byte and then any number of data bytes, all of
+ * which land in the same register.
+ */
+
+/**
+ *  IRQ Pin
+ * Driven push-pull and inverted, so it idles high and falls when any
+ * enabled source in ComIEnReg/DivIEnReg is set. Every reader's IRQ goes to
+ * its own change notification pin, and they all share the CN interrupt.
+ */
+
+/*
+ * Registers the chip changes on its own, one bit per register.
+ * CommandReg, the IRQ/error/status registers, FIFO, ControlReg (RxLastBits),
+ * CollReg (CollPos), the CRC result, the timer counter and the test block.
+ */
+static const uint16_t volatileRegs[REGISTER_COUNT / 16] = { 0x57F2, 0x0000, 0xC006, 0xFF7F };
+
+static struct {
+    mfrc522_t *readers[MAX_READERS];
+    unsigned int cnt;
+    int task; // Woken whenever a reader raises its IRQ or a FIFO transfer finishes
+}_module = { {0}, 0, -1 };
+
+/*=============================================================================
+Input Change Notification Interrupt Service Routine
+=============================================================================*/
+void __attribute__((interrupt, no_auto_psv)) _CNInterrupt(void)
+{
+    unsigned int i = 0;
+    for(; i < _module.cnt; ++i) {
+        mfrc522_t *rdr = _module.readers[i];
+        if(!(*rdr->irqPort & rdr->irqMask)) {
+            rdr->irqPending = 1;
+            SchedulerMarkRunnable(_module.task);
+        }
+    }
+    IFS1bits.CNIF = 0;		//Clear the CN Interrupt Flag
+}
+
+int InitReader(mfrc522_t *rdr, const readerPins_t *pins)
+{
+    if(_module.cnt >= MAX_READERS) return -1;
+
+    *pins->csTris &= ~pins->csMask;
+    SPIConfigureDevice(&rdr->spi, CLOCK_RATE, SPI_CLOCK, SPI_MODE, pins->csLat, pins->csMask);
+
+    *pins->irqTris |= pins->irqMask;
+    rdr->irqPort = pins->irqPort;
+    rdr->irqMask = pins->irqMask;
+    rdr->index = _module.cnt;
+    rdr->saved = 0;
+    InvalidateRegisters(rdr);
+
+    /* Park the IRQ pin high until a command enables a source */
+    WriteRegister(rdr, COM_IEN_REG, IRQ_INV);
+    WriteRegister(rdr, DIV_IEN_REG, IRQ_PUSH_PULL);
+    WriteRegister(rdr, COM_IRQ_REG, 0x7F);
+    WriteRegister(rdr, DIV_IRQ_REG, 0x7F);
+
+    rdr->st = CommandIdle;
+    rdr->irqPending = 0;
+    rdr->fifoLen = 0;
+    rdr->dmaDone = 0;
+
+    IEC1bits.CNIE = 0;
+    _module.readers[_module.cnt++] = rdr;
+    *pins->cnEnable |= pins->cnMask;
+    IFS1bits.CNIF = 0;
+    IEC1bits.CNIE = 1;
+    return 0;
+}
+
+void SetIrqTask(int task)
+{
+    _module.task = task;
+}
+
+int IsVolatile(uint8_t reg)
+{
+    return (volatileRegs[reg >> 4] >> (reg & 0x0F)) & 0x01;
+}
+
+int IsCached(mfrc522_t *rdr, uint8_t reg)
+{
+    return (rdr->valid[reg >> 4] >> (reg & 0x0F)) & 0x01;
+}
+
+void InvalidateRegisters(mfrc522_t *rdr)
+{
+    unsigned int i = 0;
+    for(; i < REGISTER_COUNT / 16; ++i) {
+        rdr->valid[i] = 0;
+    }
+}
+
+void UpdateShadow(mfrc522_t *rdr, uint8_t reg, uint8_t val)
+{
+    if(IsVolatile(reg)) return;
+    rdr->shadow[reg] = val;
+    rdr->valid[reg >> 4] |= 1 << (reg & 0x0F);
+}
+
+void WriteRegister(mfrc522_t *rdr, uint8_t reg, uint8_t val)
+{
+    /* StartSend is an action rather than a setting, so it always goes out */
+    uint8_t setting = (reg == BIT_FRAMING_REG) ? (val & 0x7F) : val;
+
+    if(setting == val && IsCached(rdr, reg) && rdr->shadow[reg] == val) {
+        rdr->saved++;
+        return;
+    }
+    StartTransaction(&rdr->spi);
+    SendSPIByte(WRITE_ADDRESS(reg));
+    SendSPIByte(val);
+    EndTransaction();
+    UpdateShadow(rdr, reg, setting);
+}
+
+uint8_t ReadRegister(mfrc522_t *rdr, uint8_t reg)
+{
+    uint8_t ret;
+
+    if(IsCached(rdr, reg)) {
+        rdr->saved++;
+        return rdr->shadow[reg];
+    }
+    StartTransaction(&rdr->spi);
+    SendSPIByte(READ_ADDRESS(reg));
+    ret = SendReceiveSPIByte(0x00); // End read
+    EndTransaction();
+    UpdateShadow(rdr, reg, ret);
+    return ret;
+}
+
+/*
+ * Writes a run of consecutive registers, skipping the ones that already
+ * hold their value. The chip takes one register per write window, so the
+ * ones that did change still go out back to back, one window each.
+ */
+void WriteRegisters(mfrc522_t *rdr, uint8_t reg, const uint8_t *vals, unsigned int cnt)
+{
+    unsigned int i = 0;
+    for(; i < cnt; ++i) {
+        WriteRegister(rdr, reg + i, vals[i]);
+    }
+}
+
+/* Reads any set of registers, with every uncached one pipelined into a single window */
+void ReadRegisters(mfrc522_t *rdr, const uint8_t *regs, uint8_t *vals, unsigned int cnt)
+{
+    unsigned int i = 0;
+    int last = -1; // Index whose data comes back on the next byte
+
+    for(; i < cnt; ++i) {
+        if(IsCached(rdr, regs[i])) {
+            rdr->saved++;
+            vals[i] = rdr->shadow[regs[i]];
+            continue;
+        }
+        if(last < 0) {
+            StartTransaction(&rdr->spi);
+            SendSPIByte(READ_ADDRESS(regs[i]));
+        } else {
+            vals[last] = SendReceiveSPIByte(READ_ADDRESS(regs[i]));
+            UpdateShadow(rdr, regs[last], vals[last]);
+        }
+        last = i;
+    }
+    if(last < 0) return;
+    vals[last] = SendReceiveSPIByte(0x00); // End read
+    EndTransaction();
+    UpdateShadow(rdr, regs[last], vals[last]);
+}
+
+/*=============================================================================
+FIFO transfer done, called from the DMA1 Interrupt Service Routine
+=============================================================================*/
+void FifoTransferDone(uint8_t *rx)
+{
+    unsigned int i = 0;
+    for(; i < _module.cnt; ++i) {
+        if(_module.readers[i]->fifo == rx) _module.readers[i]->dmaDone = 1;
+    }
+    SchedulerMarkRunnable(_module.task);
+}
+
+/*
+ * The reader is told apart by its own buffer coming back, which is known
+ * before the transfer starts. It can finish before SPITransfer returns, and
+ * one that was refused must not take the completion of the one on the bus.
+ * What comes back while loading is never read, so it goes there as well.
+ */
+int StartFifoTransfer(mfrc522_t *rdr, unsigned int cnt)
+{
+    rdr->dmaDone = 0;
+    rdr->start = Millis();
+    return SPITransfer(&rdr->spi, rdr->fifo, rdr->fifo, cnt, FifoTransferDone);
+}
+
+/* Returns -1 if the transfer couldn't be started, nothing is read then */
+int StartFifoRead(mfrc522_t *rdr, unsigned int cnt)
+{
+    unsigned int i = 0;
+
+    for(; i < cnt; ++i) {
+        rdr->fifo[i] = READ_ADDRESS(FIFO_DATA_REG);
+    }
+    rdr->fifo[cnt] = 0x00; /* Null terminate transaction */
+    rdr->fifoLen = cnt;
+    if(StartFifoTransfer(rdr, cnt + 1) < 0) {
+        rdr->fifoLen = 0;
+        return -1;
+    }
+    return 0;
+}
+
+/* Returns -1 if the transfer couldn't be started */
+int StartFifoWrite(mfrc522_t *rdr, const uint8_t *dat, unsigned int cnt)
+{
+    unsigned int i = 0;
+
+    rdr->fifo[0] = WRITE_ADDRESS(FIFO_DATA_REG);
+    for(; i < cnt; ++i) {
+        rdr->fifo[i + 1] = dat[i];
+    }
+    return StartFifoTransfer(rdr, cnt + 1);
+}
+
+unsigned int GetFifo(mfrc522_t *rdr, uint8_t *dat, unsigned int max)
+{
+    unsigned int cnt = rdr->fifoLen;
+    unsigned int i = 0;
+
+    if(cnt > max) cnt = max;
+    /* First byte back is clocked out during the first address */
+    for(; i < cnt; ++i) {
+        dat[i] = rdr->fifo[i + 1];
+    }
+    return cnt;
+}
+
+void LimitFifoRead(mfrc522_t *rdr, unsigned int max)
+{
+    rdr->readMax = max;
+}
+
+uint8_t CommandError(mfrc522_t *rdr)
+{
+    return rdr->error;
+}
+
+void FlushFifo(mfrc522_t *rdr)
+{
+    WriteRegister(rdr, FIFO_LEVEL_REG, 0x80);
+}
+
+/*
+ * Clears every request flag, which lets the IRQ pin go high again. The
+ * enables are left alone so the next command with the same sources doesn't
+ * have to write them again.
+ */
+void ClearIrq(mfrc522_t *rdr)
+{
+    WriteRegister(rdr, COM_IRQ_REG, 0x7F);
+    WriteRegister(rdr, DIV_IRQ_REG, 0x7F);
+    rdr->irqPending = 0;
+}
+
+void SetupCommand(mfrc522_t *rdr, uint8_t cmd, uint8_t comIrq, uint8_t divIrq, unsigned int timeout)
+{
+    rdr->cmd = cmd;
+    rdr->comIrq = comIrq;
+    rdr->divIrq = divIrq;
+    rdr->irq = 0;
+    rdr->error = 0;
+    rdr->fifoLen = 0;
+    rdr->readMax = FIFO_SIZE;
+    rdr->timeout = timeout;
+}
+
+void RunCommand(mfrc522_t *rdr)
+{
+    WriteRegister(rdr, COM_IRQ_REG, 0x7F);
+    WriteRegister(rdr, DIV_IRQ_REG, 0x7F);
+    rdr->irqPending = 0;
+    WriteRegister(rdr, COM_IEN_REG, IRQ_INV | rdr->comIrq);
+    WriteRegister(rdr, DIV_IEN_REG, IRQ_PUSH_PULL | rdr->divIrq);
+
+    rdr->start = Millis();
+    rdr->st = CommandBusy;
+
+    TRACE(TRACE_CMD_START, TRACE_CMD_ARG(rdr->index, rdr->cmd));
+    WriteRegister(rdr, COMMAND_REG, rdr->cmd);
+    if(rdr->cmd == CMD_TRANSCEIVE || rdr->cmd == CMD_TRANSMIT) {
+        WriteRegister(rdr, BIT_FRAMING_REG, 0x80 | rdr->framing); // StartSend
+    }
+}
+
+int CommandRunning(mfrc522_t *rdr)
+{
+    return rdr->st == CommandBusy || rdr->st == CommandLoading || rdr->st == CommandReading;
+}
+
+int StartCommand(mfrc522_t *rdr, uint8_t cmd, uint8_t comIrq, uint8_t divIrq, unsigned int timeout)
+{
+    if(CommandRunning(rdr)) return -1;
+
+    SetupCommand(rdr, cmd, comIrq, divIrq, timeout);
+    rdr->framing = 0;
+    RunCommand(rdr);
+    return 0;
+}
+
+/*
+ * Returns -1 if a command is already running, -2 for a bad length and -3 if
+ * the transfer couldn't be started, in which case the command reports
+ * CommandTimeout so whoever waits on it gives up like any other failure.
+ */
+int StartFifoCommand(mfrc522_t *rdr, uint8_t cmd, const uint8_t *dat, unsigned int cnt, uint8_t framing,
+        uint8_t comIrq, uint8_t divIrq, unsigned int timeout)
+{
+    if(CommandRunning(rdr)) return -1;
+    if(cnt == 0 || cnt > FIFO_SIZE) return -2;
+
+    SetupCommand(rdr, cmd, comIrq, divIrq, timeout);
+    rdr->framing = framing;
+    FlushFifo(rdr);
+
+    if(StartFifoWrite(rdr, dat, cnt) < 0) {
+        rdr->st = CommandTimeout;
+        return -3;
+    }
+    rdr->st = CommandLoading;
+    return 0;
+}
+
+/*
+ * FIFO access on its own, run like a command with CMD_IDLE standing for no
+ * command to follow. Same return values as StartFifoCommand.
+ */
+int WriteFifo(mfrc522_t *rdr, const uint8_t *dat, unsigned int cnt)
+{
+    if(CommandRunning(rdr)) return -1;
+    if(cnt == 0 || cnt > FIFO_SIZE) return -2;
+
+    SetupCommand(rdr, CMD_IDLE, 0, 0, 0);
+    if(StartFifoWrite(rdr, dat, cnt) < 0) {
+        rdr->st = CommandTimeout;
+        return -3;
+    }
+    rdr->st = CommandLoading;
+    return 0;
+}
+
+int ReadFifo(mfrc522_t *rdr, unsigned int max)
+{
+    unsigned int cnt;
+
+    if(CommandRunning(rdr)) return -1;
+
+    SetupCommand(rdr, CMD_IDLE, 0, 0, 0);
+    cnt = ReadRegister(rdr, FIFO_LEVEL_REG) & 0x7F;
+    if(cnt > max) cnt = max;
+    if(cnt > FIFO_SIZE) cnt = FIFO_SIZE;
+    if(cnt == 0) {
+        rdr->st = CommandDone;
+        return 0;
+    }
+    if(StartFifoRead(rdr, cnt) < 0) {
+        rdr->st = CommandTimeout;
+        return -3;
+    }
+    rdr->st = CommandReading;
+    return 0;
+}
+
+/* Data is only there when something was actually received */
+int ReadsBack(mfrc522_t *rdr)
+{
+    if(rdr->cmd == CMD_MEM) return 1;
+    if(rdr->cmd == CMD_TRANSCEIVE || rdr->cmd == CMD_RECEIVE) return (rdr->irq & RX_IRQ) != 0;
+    return 0;
+}
+
+unsigned int Elapsed(mfrc522_t *rdr)
+{
+    return Millis() - rdr->start;
+}
+
+/* Reader is stuck, its IRQ line is, or nothing answered, abort the command */
+void CommandTimedOut(mfrc522_t *rdr)
+{
+    WriteRegister(rdr, COMMAND_REG, CMD_IDLE);
+    ClearIrq(rdr);
+    rdr->st = CommandTimeout;
+    TRACE(TRACE_CMD_TIMEOUT, TRACE_CMD_ARG(rdr->index, rdr->cmd));
+}
+
+/* DMA never finished, so the bus is taken back without talking to the chip */
+void TransferTimedOut(mfrc522_t *rdr)
+{
+    /* Still loading means the command never started, so there is no start to pair with */
+    if(rdr->st == CommandReading && rdr->cmd != CMD_IDLE) {
+        TRACE(TRACE_CMD_TIMEOUT, TRACE_CMD_ARG(rdr->index, rdr->cmd));
+    }
+    SPICancelTransfer();
+    rdr->fifoLen = 0;
+    rdr->st = CommandTimeout;
+}
+
+void CommandFinished(mfrc522_t *rdr)
+{
+    rdr->st = CommandDone;
+    /* A FIFO transfer on its own never traced a start */
+    if(rdr->cmd != CMD_IDLE) TRACE(TRACE_CMD_DONE, TRACE_CMD_ARG(rdr->index, rdr->cmd));
+}
+
+enum commandStatus CommandProcess(mfrc522_t *rdr)
+{
+    static const uint8_t irqRegs[] = { COM_IRQ_REG, DIV_IRQ_REG };
+    uint8_t irq[2];
+    uint8_t com;
+    uint8_t div;
+
+    static const uint8_t resultRegs[] = { ERROR_REG, FIFO_LEVEL_REG };
+    uint8_t result[2];
+    unsigned int cnt;
+
+    switch(rdr->st) {
+        case CommandLoading:
+        case CommandReading:
+            if(!rdr->dmaDone) {
+                if(Elapsed(rdr) < TRANSFER_TIMEOUT) return CommandBusy;
+                TransferTimedOut(rdr);
+                return rdr->st;
+            }
+            if(rdr->st == CommandReading || rdr->cmd == CMD_IDLE) {
+                CommandFinished(rdr);
+                return rdr->st;
+            }
+            /* Frame is in the FIFO, now the command can go */
+            RunCommand(rdr);
+            return CommandBusy;
+        case CommandBusy:
+            break;
+        default:
+            return rdr->st;
+    }
+
+    /* First on every pass, a line stuck low would otherwise keep it busy for good */
+    if(Elapsed(rdr) >= rdr->timeout) {
+        CommandTimedOut(rdr);
+        return rdr->st;
+    }
+
+    /* Pin is checked as well in case an edge came in while flags were cleared */
+    if(!rdr->irqPending && (*rdr->irqPort & rdr->irqMask)) return rdr->st;
+    rdr->irqPending = 0;
+
+    ReadRegisters(rdr, irqRegs, irq, 2);
+    com = irq[0] & rdr->comIrq;
+    div = irq[1] & rdr->divIrq;
+    if(com == 0 && div == 0) return rdr->st;
+
+    /* CalcCRC and Transceive never go back to idle on their own */
+    if(rdr->cmd == CMD_CALC_CRC || rdr->cmd == CMD_TRANSCEIVE) {
+        WriteRegister(rdr, COMMAND_REG, CMD_IDLE);
+    }
+    ClearIrq(rdr);
+    rdr->irq = com | div;
+
+    if(ReadsBack(rdr)) {
+        ReadRegisters(rdr, resultRegs, result, 2);
+        rdr->error = result[0];
+        cnt = result[1] & 0x7F;
+        if(cnt > rdr->readMax) cnt = rdr->readMax;
+        /* Reported as done either way, with nothing to hand out if the read didn't start */
+        if(cnt > 0 && StartFifoRead(rdr, cnt) == 0) {
+            rdr->st = CommandReading;
+            return CommandBusy;
+        }
+    }
+    CommandFinished(rdr);
+    return rdr->st;
+}
+
+uint8_t CommandIrq(mfrc522_t *rdr)
+{
+    return rdr->irq;
+}
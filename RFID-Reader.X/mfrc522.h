@@ -0,0 +1,187 @@
+
+#ifndef __MFRC522_H_
+#define	__MFRC522_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "spiDriver.h"
+
+// Registers
+#define COMMAND_REG        0x01
+#define COM_IEN_REG        0x02
+#define DIV_IEN_REG        0x03
+#define COM_IRQ_REG        0x04
+#define DIV_IRQ_REG        0x05
+#define ERROR_REG          0x06
+#define STATUS1_REG        0x07
+#define STATUS2_REG        0x08
+#define FIFO_DATA_REG      0x09
+#define FIFO_LEVEL_REG     0x0A
+#define WATER_LEVEL_REG    0x0B
+#define CONTROL_REG        0x0C
+#define BIT_FRAMING_REG    0x0D
+#define COLL_REG           0x0E
+#define MODE_REG           0x11
+#define TX_MODE_REG        0x12
+#define RX_MODE_REG        0x13
+#define TX_CONTROL_REG     0x14
+#define TX_ASK_REG         0x15
+#define CRC_RESULT_REG_H   0x21
+#define CRC_RESULT_REG_L   0x22
+#define MOD_WIDTH_REG      0x24
+#define RF_CFG_REG         0x26
+#define T_MODE_REG         0x2A
+#define T_PRESCALER_REG    0x2B
+#define T_RELOAD_REG_H     0x2C
+#define T_RELOAD_REG_L     0x2D
+#define VERSION_REG        0x37
+
+// Commands
+#define CMD_IDLE            0x00
+#define CMD_MEM             0x01
+#define CMD_GENERATE_RANDOM 0x02
+#define CMD_CALC_CRC        0x03
+#define CMD_TRANSMIT        0x04
+#define CMD_RECEIVE         0x08
+#define CMD_TRANSCEIVE      0x0C
+#define CMD_SOFT_RESET      0x0F
+
+// ComIEnReg/ComIrqReg bits
+#define IRQ_INV       0x80
+#define TX_IRQ        0x40
+#define RX_IRQ        0x20
+#define IDLE_IRQ      0x10
+#define HI_ALERT_IRQ  0x08
+#define LO_ALERT_IRQ  0x04
+#define ERR_IRQ       0x02
+#define TIMER_IRQ     0x01
+
+// DivIEnReg/DivIrqReg bits
+#define IRQ_PUSH_PULL 0x80
+#define CRC_IRQ       0x04
+
+#define FIFO_SIZE 64
+#define REGISTER_COUNT 64
+
+#define MAX_READERS 4
+
+enum commandStatus {
+    CommandIdle,
+    CommandBusy,
+    CommandDone,
+    CommandTimeout,
+    CommandLoading, // FIFO going out over DMA, reported as CommandBusy
+    CommandReading, // FIFO coming back over DMA, reported as CommandBusy
+};
+
+/* Where one reader is wired up */
+typedef struct {
+    volatile unsigned int *csTris;
+    volatile unsigned int *csLat;
+    unsigned int csMask;
+    volatile unsigned int *irqTris;
+    volatile unsigned int *irqPort;
+    unsigned int irqMask;
+    volatile unsigned int *cnEnable; // CNEN1 or CNEN2
+    unsigned int cnMask;
+} readerPins_t;
+
+/* One MFRC522 and its command engine */
+typedef struct {
+    spiDevice_t spi;
+    volatile unsigned int *irqPort;
+    unsigned int irqMask;
+    uint8_t index; // Order InitReader saw it in, traces tell readers apart by it
+
+    enum commandStatus st;
+
+    uint8_t cmd;
+    uint8_t comIrq;
+    uint8_t divIrq;
+    uint8_t irq;
+
+    unsigned int start;
+    unsigned int timeout;
+
+    /* FIFO contents go out and come back over DMA through here, address byte first */
+    uint8_t fifo[FIFO_SIZE + 1];
+    uint8_t fifoLen;
+    uint8_t readMax;
+    uint8_t framing;
+    uint8_t error;    // ErrorReg when the last command finished
+    volatile uint8_t dmaDone;
+
+    /* Write-through copy of the configuration registers */
+    uint8_t shadow[REGISTER_COUNT];
+    uint16_t valid[REGISTER_COUNT / 16];
+    unsigned long saved; // Accesses answered or skipped without touching SPI
+
+    volatile unsigned irqPending : 1;
+} mfrc522_t;
+
+/* Address byte for a register, MSB set means read */
+#define READ_ADDRESS(reg)  (0x80 | ((reg) << 1))
+#define WRITE_ADDRESS(reg) (0x00 | ((reg) << 1))
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    int InitReader(mfrc522_t *rdr, const readerPins_t *pins);
+    /* Scheduler task to mark runnable when any reader's IRQ pin falls */
+    void SetIrqTask(int task);
+
+    /*
+     * Configuration registers go through a shadow copy, so writing a value
+     * that is already there costs nothing and reading one comes from RAM.
+     * Status, IRQ, FIFO and result registers always go to the chip.
+     * Only reads are batched: ReadRegisters pipelines every uncached one
+     * into a single window, while the chip takes one register per write
+     * window, so WriteRegisters still sends each changed one on its own.
+     */
+    void WriteRegister(mfrc522_t *rdr, uint8_t reg, uint8_t val);
+    uint8_t ReadRegister(mfrc522_t *rdr, uint8_t reg);
+    void WriteRegisters(mfrc522_t *rdr, uint8_t reg, const uint8_t *vals, unsigned int cnt);
+    void ReadRegisters(mfrc522_t *rdr, const uint8_t *regs, uint8_t *vals, unsigned int cnt);
+    void InvalidateRegisters(mfrc522_t *rdr);
+
+    void FlushFifo(mfrc522_t *rdr);
+    /*
+     * FIFO access over DMA in one chip-select window, outside any command.
+     * ReadFifo reads FIFOLevelReg once and then up to max bytes, WriteFifo
+     * loads cnt bytes. Each is followed with CommandProcess like a command,
+     * and once it reports CommandDone GetFifo hands out what was read.
+     */
+    int ReadFifo(mfrc522_t *rdr, unsigned int max);
+    int WriteFifo(mfrc522_t *rdr, const uint8_t *dat, unsigned int cnt);
+
+    /*
+     * Command engine, StartCommand returns right away and CommandProcess
+     * advances it from the main loop. Completion comes from the IRQ pin, so
+     * nothing is sent over SPI while a command is in flight.
+     */
+    int StartCommand(mfrc522_t *rdr, uint8_t cmd, uint8_t comIrq, uint8_t divIrq, unsigned int timeout);
+    /*
+     * Same, but first loads dat into the FIFO over DMA, and the command only
+     * goes out once the transfer is done. framing is BitFramingReg for
+     * Transmit and Transceive, written with StartSend right after the command.
+     */
+    int StartFifoCommand(mfrc522_t *rdr, uint8_t cmd, const uint8_t *dat, unsigned int cnt, uint8_t framing,
+            uint8_t comIrq, uint8_t divIrq, unsigned int timeout);
+    enum commandStatus CommandProcess(mfrc522_t *rdr);
+    uint8_t CommandIrq(mfrc522_t *rdr);
+
+    /*
+     * Whatever Transceive, Receive or Mem left in the FIFO is read back over
+     * DMA before CommandProcess reports CommandDone, GetFifo hands it out.
+     * LimitFifoRead caps how much of it the running command reads back.
+     */
+    void LimitFifoRead(mfrc522_t *rdr, unsigned int max);
+    unsigned int GetFifo(mfrc522_t *rdr, uint8_t *dat, unsigned int max);
+    uint8_t CommandError(mfrc522_t *rdr);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
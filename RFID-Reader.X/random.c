@@ -0,0 +1,179 @@
+/*
+ * File:   random.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+
+#include "xc.h"
+#include "mfrc522.h"
+#include "random.h"
+
+#define COMMAND_TIMEOUT 25 // ms
+
+/*
+ * GenerateRandomID writes 10 random bytes into the 25 byte internal buffer
+ * and Mem copies the whole buffer out to the FIFO. The datasheet doesn't say
+ * which 10 get overwritten, these are the ones we have always taken from.
+ */
+#define RANDOM_ID_OFFSET 0
+#define RANDOM_ID_LENGTH 10
+
+enum randomStates {
+    RandomIdle,
+    RandomGenerate,
+    RandomMem,
+};
+
+static struct {
+    mfrc522_t *rdr;
+
+    enum randomStates st;
+
+    uint8_t pool[RANDOM_POOL_SIZE];
+    unsigned int startCnt;
+    unsigned int endCnt;
+    unsigned int cnt;
+
+    /* Leftover bits of a byte that has been partly used */
+    uint8_t bits;
+    uint8_t bitCnt;
+
+    /* Fast Dice Roller state, kept when the pool runs dry mid-draw */
+    unsigned long v;
+    unsigned long c;
+    unsigned int n;
+
+    unsigned long generated;
+} _module = {0};
+
+void InitRandom(mfrc522_t *rdr)
+{
+    _module.rdr = rdr;
+}
+
+void PoolPut(uint8_t b)
+{
+    _module.pool[_module.endCnt] = b;
+    _module.endCnt++;
+    if(_module.endCnt >= RANDOM_POOL_SIZE) _module.endCnt = 0;
+    _module.cnt++;
+}
+
+uint8_t PoolGet()
+{
+    uint8_t b = _module.pool[_module.startCnt];
+    _module.startCnt++;
+    if(_module.startCnt >= RANDOM_POOL_SIZE) _module.startCnt = 0;
+    _module.cnt--;
+    return b;
+}
+
+/* Runs one batch whenever a whole batch fits, one step per call */
+void RandomProcess()
+{
+    uint8_t dat[RANDOM_ID_OFFSET + RANDOM_ID_LENGTH];
+    unsigned int i;
+    enum commandStatus cmd;
+
+    if(SPIBusy()) return;
+
+    switch(_module.st) {
+        case RandomIdle:
+            if(RANDOM_POOL_SIZE - _module.cnt < RANDOM_ID_LENGTH) break;
+            FlushFifo(_module.rdr);
+            if(StartCommand(_module.rdr, CMD_GENERATE_RANDOM, IDLE_IRQ, 0, COMMAND_TIMEOUT) < 0) break;
+            _module.st = RandomGenerate;
+            break;
+        case RandomGenerate:
+            cmd = CommandProcess(_module.rdr);
+            if(cmd == CommandBusy) break;
+            if(cmd == CommandTimeout) {
+                _module.st = RandomIdle;
+                break;
+            }
+            /* Just move internal buffer to FIFO, and only clock out as far as the random bytes go */
+            StartCommand(_module.rdr, CMD_MEM, IDLE_IRQ, 0, COMMAND_TIMEOUT);
+            LimitFifoRead(_module.rdr, sizeof(dat));
+            _module.st = RandomMem;
+            break;
+        case RandomMem:
+            cmd = CommandProcess(_module.rdr);
+            if(cmd == CommandBusy) break;
+            if(cmd == CommandDone && GetFifo(_module.rdr, dat, sizeof(dat)) == sizeof(dat)) {
+                for(i = RANDOM_ID_OFFSET; i < sizeof(dat); ++i) {
+                    PoolPut(dat[i]);
+                }
+                _module.generated += RANDOM_ID_LENGTH;
+            }
+            FlushFifo(_module.rdr);
+            _module.st = RandomIdle;
+            break;
+    }
+}
+
+int RandomBusy()
+{
+    return _module.st != RandomIdle;
+}
+
+unsigned int RandomBytes(uint8_t *dat, unsigned int n)
+{
+    unsigned int i = 0;
+    for(; i < n && _module.cnt > 0; ++i) {
+        dat[i] = PoolGet();
+    }
+    return i;
+}
+
+/*
+ * Uniform value in [0, n) using Lumbroso's Fast Dice Roller, which needs
+ * about log2(n) + 2 bits per value instead of throwing whole draws away.
+ * Returns 1 and fills out when a value is ready.
+ */
+int RandomBelow(unsigned int n, unsigned int *out)
+{
+    if(n < 2) {
+        *out = 0;
+        return 1;
+    }
+    if(n != _module.n) {
+        _module.n = n;
+        _module.v = 1;
+        _module.c = 0;
+    }
+
+    while(1) {
+        if(_module.bitCnt == 0) {
+            if(_module.cnt == 0) return 0;
+            _module.bits = PoolGet();
+            _module.bitCnt = 8;
+        }
+        _module.v <<= 1;
+        _module.c = (_module.c << 1) | (_module.bits & 0x01);
+        _module.bits >>= 1;
+        _module.bitCnt--;
+
+        if(_module.v >= n) {
+            if(_module.c < n) {
+                *out = _module.c;
+                _module.v = 1;
+                _module.c = 0;
+                return 1;
+            }
+            _module.v -= n;
+            _module.c -= n;
+        }
+    }
+}
+
+unsigned int RandomAvailable()
+{
+    return _module.cnt;
+}
+
+unsigned long RandomGenerated()
+{
+    return _module.generated;
+}
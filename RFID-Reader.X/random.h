@@ -0,0 +1,30 @@
+
+#ifndef __RANDOM_H_
+#define	__RANDOM_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "mfrc522.h"
+
+#define RANDOM_POOL_SIZE 64
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void InitRandom(mfrc522_t *rdr);
+    void RandomProcess();
+    int RandomBusy();
+
+    /* Neither call blocks, they hand out what the pool has right now */
+    unsigned int RandomBytes(uint8_t *dat, unsigned int n);
+    int RandomBelow(unsigned int n, unsigned int *out);
+
+    unsigned int RandomAvailable();
+    unsigned long RandomGenerated();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
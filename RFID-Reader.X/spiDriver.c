@@ -0,0 +1,269 @@
+/*
+ * File:   spiDriver.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 9:02 AM
+ */
+
+
+#include "xc.h"
+#include "spiDriver.h"
+#include "../Common/busCapture.h"
+
+/**
+ *  SPI Pin assignments
+ * MISO - RP15 (26)
+ * MOSI - RP14 (25)
+ * CLK  - RP13 (24)
+ * CS   - per device, see spiDevice_t
+ */
+
+/**
+ *  RPN Codes
+ * MISO1 RPINR20
+ * MOSI1 00111
+ * CLK1  01000
+ */
+
+/**
+ *  DMA assignments
+ * DMA0 - RAM to SPI1BUF (TX)
+ * DMA1 - SPI1BUF to RAM (RX), its interrupt marks the end of a transfer
+ */
+#define DMA_REQ_SPI1 0x0A
+
+// SPI1CON1 fields
+#define CON1_CKE     (1 << 8)
+#define CON1_CKP     (1 << 6)
+#define CON1_MSTEN   (1 << 5)
+#define CON1_SPRE(x) ((x) << 2)
+#define CON1_PPRE(x) (x)
+
+/* DMA can only reach DMA RAM, so transfers are staged through these */
+static uint8_t _txBuf[SPI_DMA_SIZE] __attribute__((space(dma)));
+static uint8_t _rxBuf[SPI_DMA_SIZE] __attribute__((space(dma)));
+
+static const uint8_t primaryScale[] = { 64, 16, 4, 1 }; // Indexed by PPRE
+
+static struct {
+    spiDevice_t *dev;     // Device that owns chip select right now
+    uint16_t con1;        // What SPI1CON1 is currently set to
+
+    uint8_t *rx;
+    unsigned int cnt;
+    void (*callbackFunction)(uint8_t *);
+
+    unsigned long bytes;
+
+    volatile unsigned busy : 1;
+}_module;
+
+/*=============================================================================
+DMA1 (SPI1 RX) Interrupt Service Routine
+=============================================================================*/
+void __attribute__((interrupt, no_auto_psv)) _DMA1Interrupt(void)
+{
+    unsigned int i = 0;
+
+#if BUS_CAPTURE
+    for(; i < _module.cnt; ++i) {
+        CAPTURE_PAIR(BUS_SPI, _txBuf[i]);
+        CAPTURE_REPLY(BUS_SPI, _rxBuf[i]);
+    }
+    i = 0;
+#endif
+    EndTransaction();
+    if(_module.rx) {
+        for(; i < _module.cnt; ++i) {
+            _module.rx[i] = _rxBuf[i];
+        }
+    }
+    _module.busy = 0;
+    if(_module.callbackFunction) (*_module.callbackFunction)(_module.rx);
+    IFS0bits.DMA1IF = 0;		//Clear the DMA1 Interrupt Flag
+}
+
+#if BUS_CAPTURE
+/* Chip-select bit, with 0x80 set for port A */
+static uint8_t captureAddress(spiDevice_t *dev)
+{
+    uint8_t bit = 0;
+    while(bit < 15 && !(dev->csMask & (1 << bit))) bit++;
+    if(dev->csPort == &LATA) bit |= 0x80;
+    return bit;
+}
+#endif
+
+void SelectDevice(spiDevice_t *dev)
+{
+    /* Module has to be off to change clock or mode, so only do it on a change */
+    if(dev->con1 != _module.con1) {
+        SPI1STATbits.SPIEN = 0;
+        SPI1CON1 = dev->con1;
+        SPI1STATbits.SPIEN = 1;
+        _module.con1 = dev->con1;
+    }
+    _module.dev = dev;
+    *dev->csPort &= ~dev->csMask;
+    CAPTURE_START(BUS_SPI, captureAddress(dev));
+}
+
+void StartTransaction(spiDevice_t *dev)
+{
+    /* Callers check SPIBusy first, this is only the backstop */
+    while(_module.busy) ;
+    SelectDevice(dev);
+}
+void EndTransaction()
+{
+    *_module.dev->csPort |= _module.dev->csMask;
+    CAPTURE_END(BUS_SPI, 0);
+}
+
+void SendSPIByte(uint8_t b)
+{
+    while(SPI1STATbits.SPITBF) ; // Wait until we can write
+    /* Dummy read to clear SPIRBF flag */
+    SPI1BUF;
+    SPI1BUF = b;
+    _module.bytes++;
+    CAPTURE_PAIR(BUS_SPI, b);
+    while(!SPI1STATbits.SPIRBF) ; // Wait until we clock out the data
+}
+
+uint8_t ReadSPIByte()
+{
+    uint8_t b = SPI1BUF;
+    CAPTURE_REPLY(BUS_SPI, b);
+    return b;
+}
+
+uint8_t SendReceiveSPIByte(uint8_t b)
+{
+    SendSPIByte(b);
+    return ReadSPIByte();
+}
+
+void InitializeSPIDriver()
+{
+    RPINR20bits.SDI1R = 15;     // RP15 (RB15)
+    RPOR7bits.RP14R = 0b00111;  // RP14 (RB14)
+    RPOR6bits.RP13R = 0b01000;  // RP13 (RB13)
+
+    SPI1STAT = 0; // SPISIDL clear, keeps running in Idle
+
+    /* Clock and mode are set per device in StartTransaction */
+    SPI1CON1 = CON1_MSTEN;
+    _module.con1 = SPI1CON1;
+
+    /* TX channel, byte-wide, RAM to peripheral, one-shot */
+    DMA0CON = 0;
+    DMA0CONbits.SIZE = 1;
+    DMA0CONbits.DIR = 1;
+    DMA0CONbits.MODE = 0b01;
+    DMA0REQ = DMA_REQ_SPI1;
+    DMA0PAD = (volatile unsigned int) &SPI1BUF;
+    DMA0STA = __builtin_dmaoffset(_txBuf);
+
+    /* RX channel, byte-wide, peripheral to RAM, one-shot */
+    DMA1CON = 0;
+    DMA1CONbits.SIZE = 1;
+    DMA1CONbits.DIR = 0;
+    DMA1CONbits.MODE = 0b01;
+    DMA1REQ = DMA_REQ_SPI1;
+    DMA1PAD = (volatile unsigned int) &SPI1BUF;
+    DMA1STA = __builtin_dmaoffset(_rxBuf);
+
+    IFS0bits.DMA1IF = 0;
+    IEC0bits.DMA1IE = 1;
+
+    SPI1STATbits.SPIEN = 1;
+}
+
+/*
+ * Picks the fastest primary/secondary prescaler pair that doesn't go over
+ * sck, and returns the clock that will actually be used.
+ * mode is the usual SPI mode 0-3 (CPOL << 1 | CPHA).
+ */
+unsigned long SPIConfigureDevice(spiDevice_t *dev, unsigned long fcy, unsigned long sck, uint8_t mode,
+        volatile unsigned int *csPort, unsigned int csMask)
+{
+    unsigned long best = 0;
+    unsigned int bestPpre = 0;
+    unsigned int bestSecondary = 8;
+    unsigned int ppre = 0;
+    unsigned int secondary;
+
+    for(; ppre < sizeof(primaryScale); ++ppre) {
+        for(secondary = 1; secondary <= 8; ++secondary) {
+            unsigned long rate = fcy / ((unsigned long) primaryScale[ppre] * secondary);
+            /* 1:1 on both is not allowed */
+            if(primaryScale[ppre] == 1 && secondary == 1) continue;
+            if(rate > sck || rate <= best) continue;
+            best = rate;
+            bestPpre = ppre;
+            bestSecondary = secondary;
+        }
+    }
+    /* Nothing fits under sck, so settle for the slowest we have */
+    if(best == 0) best = fcy / (64UL * 8);
+
+    dev->con1 = CON1_MSTEN | CON1_PPRE(bestPpre) | CON1_SPRE(8 - bestSecondary);
+    if(!(mode & 0x01)) dev->con1 |= CON1_CKE; // CPHA 0, data changes going back to idle
+    if(mode & 0x02) dev->con1 |= CON1_CKP;    // CPOL 1, clock idles high
+    dev->csPort = csPort;
+    dev->csMask = csMask;
+    *csPort |= csMask; /* Keep it high */
+    return best;
+}
+
+int SPITransfer(spiDevice_t *dev, uint8_t *tx, uint8_t *rx, unsigned int cnt, void (*callback)(uint8_t*))
+{
+    if(_module.busy) return -1;
+    if(cnt == 0 || cnt > SPI_DMA_SIZE) return -2;
+
+    unsigned int i = 0;
+    for(; i < cnt; ++i) {
+        _txBuf[i] = tx[i];
+    }
+    _module.rx = rx;
+    _module.cnt = cnt;
+    _module.callbackFunction = callback;
+    _module.bytes += cnt;
+    _module.busy = 1;
+
+    /* Clear out anything left over from the blocking interface */
+    SPI1BUF;
+    SPI1STATbits.SPIROV = 0;
+
+    DMA0CNT = cnt - 1;
+    DMA1CNT = cnt - 1;
+
+    SelectDevice(dev);
+    DMA1CONbits.CHEN = 1;
+    DMA0CONbits.CHEN = 1;
+    /* SPI only requests on a completed byte, so kick off the first one */
+    DMA0REQbits.FORCE = 1;
+    return 0;
+}
+
+int SPIBusy()
+{
+    return _module.busy;
+}
+
+void SPICancelTransfer()
+{
+    if(!_module.busy) return;
+    DMA0CONbits.CHEN = 0;
+    DMA1CONbits.CHEN = 0;
+    IFS0bits.DMA1IF = 0;
+    *_module.dev->csPort |= _module.dev->csMask;
+    CAPTURE_END(BUS_SPI, CAPTURE_FAILED);
+    _module.busy = 0;
+}
+
+unsigned long SPIBytes()
+{
+    return _module.bytes;
+}
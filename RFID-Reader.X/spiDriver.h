@@ -0,0 +1,62 @@
+
+#ifndef __SPI_DRIVER_H_
+#define	__SPI_DRIVER_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+
+/* Largest transfer the DMA engine can take in one chip-select window */
+#define SPI_DMA_SIZE 72
+
+/*
+ * Everything SPI1 needs to talk to one device. The bus is only reconfigured
+ * when a transaction starts on a device whose settings differ from the last.
+ *
+ * Wire time of a two byte register access, computed from SCK (16 bit
+ * times), not measured. CPU overhead is not included, SpiBenchmark in
+ * main.c times the whole access on target.
+ *   Fcy 3.685 MHz, old fixed Fcy/8 -> 461 kHz SCK,  34.7 us
+ *   Fcy 3.685 MHz, 10 MHz target   -> 1.84 MHz SCK, 8.7 us
+ *   Fcy 16 MHz,    10 MHz target   -> 8 MHz SCK,    2 us  (PLL)
+ *   Fcy 40 MHz,    10 MHz target   -> 10 MHz SCK,   1.6 us (PLL)
+ */
+typedef struct {
+    uint16_t con1;                 // SPI1CON1 image, prescalers and mode
+    volatile unsigned int *csPort; // LAT register holding chip select
+    unsigned int csMask;
+} spiDevice_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void InitializeSPIDriver();
+    unsigned long SPIConfigureDevice(spiDevice_t *dev, unsigned long fcy, unsigned long sck, uint8_t mode,
+            volatile unsigned int *csPort, unsigned int csMask);
+
+    /* Blocking byte interface, StartTransaction waits out a DMA transfer still running */
+    void StartTransaction(spiDevice_t *dev);
+    void EndTransaction();
+    void SendSPIByte(uint8_t b);
+    uint8_t ReadSPIByte();
+    uint8_t SendReceiveSPIByte(uint8_t b);
+
+    /*
+     * DMA interface, returns immediately.
+     * Chip select is held low for the whole transfer and released in the
+     * DMA interrupt, after which rx is filled and callback (if any) is called
+     * from interrupt context.
+     */
+    int SPITransfer(spiDevice_t *dev, uint8_t *tx, uint8_t *rx, unsigned int cnt, void (*callback)(uint8_t*));
+    int SPIBusy();
+    /* Gives up on a transfer whose interrupt never came, chip select is released and no callback is made */
+    void SPICancelTransfer();
+
+    /* Bytes clocked over the bus so far, both interfaces */
+    unsigned long SPIBytes();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,191 @@
+/*
+ * File:   tagTracker.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 5:10 PM
+ */
+
+
+#include "xc.h"
+#include "iso14443a.h"
+#include "tagTracker.h"
+#include "../Common/scheduler.h"
+
+#define DEFAULT_HOLD_OFF 200      // ms
+#define DEFAULT_CHECK_INTERVAL 50 // ms
+
+/*
+ * Every tag we read gets halted, so after the first read REQA only turns up
+ * new tags. The ones already in the table are checked with a WUPA and a
+ * select by UID, which skips anticollision entirely. Downstream only hears
+ * about a tag when it shows up and when it has been gone for holdOff.
+ */
+
+void PushEvent(tagTracker_t *tr, enum tagEventType type, trackedTag_t *tag)
+{
+    tagEvent_t *ev;
+    int i = 0;
+
+    if(tr->cnt >= TRACK_EVENTS) {
+        tr->dropped++;
+        return;
+    }
+    ev = &tr->events[tr->head];
+    ev->type = type;
+    for(; i < tag->uidLen; ++i) {
+        ev->uid[i] = tag->uid[i];
+    }
+    ev->uidLen = tag->uidLen;
+    tr->head = (tr->head + 1) % TRACK_EVENTS;
+    tr->cnt++;
+}
+
+int SameUid(trackedTag_t *tag, uint8_t *uid, int len)
+{
+    int i = 0;
+    if(tag->uidLen != len) return 0;
+    for(; i < len; ++i) {
+        if(tag->uid[i] != uid[i]) return 0;
+    }
+    return 1;
+}
+
+/* A tag came back from a full read, either brand new or one we lost track of */
+void TagSeen(tagTracker_t *tr, uint8_t *uid, int len)
+{
+    trackedTag_t *slot = 0;
+    int i = 0;
+
+    for(; i < TRACK_SIZE; ++i) {
+        trackedTag_t *tag = &tr->tags[i];
+        if(tag->used && SameUid(tag, uid, len)) {
+            /* Left and came back inside the hold-off, nobody needs to know */
+            tag->lastSeen = Millis();
+            tag->lastCheck = tag->lastSeen;
+            return;
+        }
+        if(!tag->used) {
+            if(!slot || slot->used) slot = tag;
+        } else if(!slot || (slot->used && (unsigned int)(Millis() - tag->lastSeen) > (unsigned int)(Millis() - slot->lastSeen))) {
+            slot = tag; // Seen longer ago than the current pick
+        }
+    }
+
+    /* Table is full, the stalest tag makes room */
+    if(slot->used) {
+        if(tr->checking == slot - tr->tags) tr->checking = -1;
+        PushEvent(tr, TagDepart, slot);
+    }
+    for(i = 0; i < len; ++i) {
+        slot->uid[i] = uid[i];
+    }
+    slot->uidLen = len;
+    slot->lastSeen = Millis();
+    slot->lastCheck = slot->lastSeen;
+    slot->used = 1;
+    PushEvent(tr, TagArrive, slot);
+}
+
+void ExpireTags(tagTracker_t *tr)
+{
+    int i = 0;
+    for(; i < TRACK_SIZE; ++i) {
+        trackedTag_t *tag = &tr->tags[i];
+        if(!tag->used || i == tr->checking) continue;
+        if((unsigned int)(Millis() - tag->lastSeen) < tr->holdOff) continue;
+        tag->used = 0;
+        PushEvent(tr, TagDepart, tag);
+        /* If it's really still there but missed its checks, it's halted and REQA won't find it */
+        CardWakeAll(tr->cr);
+    }
+}
+
+/* Starts a check on whichever known tag has waited the longest for one */
+void StartCheck(tagTracker_t *tr)
+{
+    trackedTag_t *next = 0;
+    int index = -1;
+    int i = 0;
+
+    for(; i < TRACK_SIZE; ++i) {
+        trackedTag_t *tag = &tr->tags[i];
+        if(!tag->used) continue;
+        if((unsigned int)(Millis() - tag->lastCheck) < tr->checkInterval) continue;
+        if(!next || (unsigned int)(Millis() - tag->lastCheck) > (unsigned int)(Millis() - next->lastCheck)) {
+            next = tag;
+            index = i;
+        }
+    }
+    if(!next) return;
+    if(CardCheck(tr->cr, next->uid, next->uidLen) < 0) return;
+    next->lastCheck = Millis();
+    tr->checking = index;
+}
+
+void TrackerInit(tagTracker_t *tr, cardReader_t *cr)
+{
+    int i = 0;
+
+    tr->cr = cr;
+    for(; i < TRACK_SIZE; ++i) {
+        tr->tags[i].used = 0;
+    }
+    tr->checking = -1;
+    tr->head = 0;
+    tr->tail = 0;
+    tr->cnt = 0;
+    tr->dropped = 0;
+    tr->holdOff = DEFAULT_HOLD_OFF;
+    tr->checkInterval = DEFAULT_CHECK_INTERVAL;
+}
+
+void TrackerProcess(tagTracker_t *tr)
+{
+    uint8_t uid[UID_SIZE];
+    int len;
+    int ret;
+
+    CardProcess(tr->cr);
+
+    ret = GetCheckResult(tr->cr);
+    if(ret >= 0) {
+        if(ret == 1 && tr->checking >= 0) tr->tags[tr->checking].lastSeen = Millis();
+        tr->checking = -1;
+    }
+
+    len = GetCardUid(tr->cr, uid);
+    if(len > 0) TagSeen(tr, uid, len);
+
+    ExpireTags(tr);
+
+    if(tr->checking < 0 && CardIdle(tr->cr)) StartCheck(tr);
+}
+
+void SetHoldOff(tagTracker_t *tr, unsigned int ms)
+{
+    tr->holdOff = ms;
+}
+
+void SetCheckInterval(tagTracker_t *tr, unsigned int ms)
+{
+    tr->checkInterval = ms;
+}
+
+int GetTagEvent(tagTracker_t *tr, tagEvent_t *ev)
+{
+    if(tr->cnt == 0) return 0;
+    *ev = tr->events[tr->tail];
+    tr->tail = (tr->tail + 1) % TRACK_EVENTS;
+    tr->cnt--;
+    return 1;
+}
+
+unsigned int TagsPresent(tagTracker_t *tr)
+{
+    unsigned int present = 0;
+    int i = 0;
+    for(; i < TRACK_SIZE; ++i) {
+        if(tr->tags[i].used) present++;
+    }
+    return present;
+}
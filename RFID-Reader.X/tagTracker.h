@@ -0,0 +1,68 @@
+
+#ifndef __TAG_TRACKER_H_
+#define	__TAG_TRACKER_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "iso14443a.h"
+
+/* Tags one reader keeps track of at once, more than this and the oldest is dropped */
+#define TRACK_SIZE 8
+#define TRACK_EVENTS 8
+
+enum tagEventType {
+    TagArrive,
+    TagDepart,
+};
+
+typedef struct {
+    enum tagEventType type;
+    uint8_t uid[UID_SIZE];
+    uint8_t uidLen;
+} tagEvent_t;
+
+typedef struct {
+    uint8_t uid[UID_SIZE];
+    uint8_t uidLen;
+    unsigned int lastSeen;
+    unsigned int lastCheck;
+    unsigned used : 1;
+} trackedTag_t;
+
+/* Presence table for the tags in front of one reader */
+typedef struct {
+    cardReader_t *cr;
+
+    trackedTag_t tags[TRACK_SIZE];
+    int checking; // Entry with a CardCheck in flight, -1 for none
+
+    tagEvent_t events[TRACK_EVENTS];
+    uint8_t head;
+    uint8_t tail;
+    uint8_t cnt;
+    unsigned int dropped;
+
+    unsigned int holdOff;       // ms a tag can go unseen before it counts as gone
+    unsigned int checkInterval; // ms between checks on a known tag
+} tagTracker_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void TrackerInit(tagTracker_t *tr, cardReader_t *cr);
+    /* Runs the card pipeline underneath, call it in place of CardProcess */
+    void TrackerProcess(tagTracker_t *tr);
+
+    void SetHoldOff(tagTracker_t *tr, unsigned int ms);
+    void SetCheckInterval(tagTracker_t *tr, unsigned int ms);
+
+    /* Returns 1 and fills ev when there's an event waiting */
+    int GetTagEvent(tagTracker_t *tr, tagEvent_t *ev);
+    unsigned int TagsPresent(tagTracker_t *tr);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,254 @@
+/*
+ * File:   main.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 10:00 PM
+ */
+
+
+#include "xc.h"
+#include "global.h"
+#include "../RFID-Reader.X/spiDriver.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/iso14443a.h"
+#include "../RFID-Reader.X/tagTracker.h"
+#include "../LCD-Demo.X/i2cDriver.h"
+#include "../LCD-Demo.X/lcdDriver.h"
+#include "../Common/scheduler.h"
+#include "../Common/trace.h"
+#include "../Common/uartDriver.h"
+#include "../Common/busCapture.h"
+#include "tagTable.h"
+
+#pragma config FNOSC = FRC
+#pragma config POSCMD = NONE
+#pragma config OSCIOFNC = OFF
+#pragma config FCKSM = CSDCMD
+#pragma config FWDTEN = OFF
+
+#define LOG_BAUD 460800
+#define REPORT_PERIOD 1000   // ms
+#define TRACE_PERIOD 10      // ms
+#define CAPTURE_PERIOD 10    // ms
+#define LATENCY_BUDGET 150   // ms from the poll that saw the tag to the last character on the glass
+#define CYCLES_PER_MS (CLOCK_RATE / 1000) // Fcy isn't a whole number of MHz
+
+/**
+ *  Reader Pin assignments
+ * CS RB12 (23), IRQ RB11 (22) CN15
+ *
+ *  LCD
+ * SCL1 RB8 (17), SDA1 RB9 (18)
+ */
+static const readerPins_t readerPins = { &TRISB, &LATB, 1 << 12, &TRISB, &PORTB, 1 << 11, &CNEN1, 1 << 15 };
+
+/*
+ * Tap to pixel, in order. Each stage is its own slice of the total, so they
+ * add up to it.
+ *   Detect  - poll start to a selected UID
+ *   Wait    - UID to the display task picking it up, mostly the LCD still busy
+ *   Lookup  - search of the tag table
+ *   Queue   - formatting and handing the text to the LCD driver
+ *   Display - text queued to the last byte acknowledged on I2C
+ */
+enum stages {
+    StageDetect,
+    StageWait,
+    StageLookup,
+    StageQueue,
+    StageDisplay,
+    StageTotal,
+    STAGE_COUNT,
+};
+
+typedef struct {
+    unsigned long last; // us
+    unsigned long max;
+} stageTime_t;
+
+static struct {
+    mfrc522_t reader;
+    cardReader_t card;
+    tagTracker_t tracker;
+
+    int displayTask;
+
+    /* Newest tag waiting for the display, an older one still waiting is just replaced */
+    uint8_t uid[UID_SIZE];
+    uint8_t uidLen;
+    unsigned long seenAt;  // Cycles() when the UID came out of the tracker
+    unsigned long queuedAt;
+    unsigned long detect;  // us
+
+    stageTime_t stages[STAGE_COUNT];
+    unsigned long overruns;
+    unsigned long superseded;
+
+    unsigned pending : 1;
+    unsigned showing : 1; // Text queued, waiting for it to reach the display
+} _module;
+
+unsigned long ToMicroseconds(unsigned long cycles)
+{
+    return cycles / CYCLES_PER_MS * 1000 + cycles % CYCLES_PER_MS * 1000 / CYCLES_PER_MS;
+}
+
+void StageDone(enum stages stage, unsigned long us)
+{
+    _module.stages[stage].last = us;
+    if(us > _module.stages[stage].max) _module.stages[stage].max = us;
+}
+
+/* Runs every ms for the tracker timing, and right away on the reader IRQ */
+void ReaderTask()
+{
+    tagEvent_t event;
+    cardStats_t stats;
+    uint8_t payload[UID_SIZE + 1];
+    int i;
+
+    TrackerProcess(&_module.tracker);
+    while(GetTagEvent(&_module.tracker, &event)) {
+        payload[0] = (event.type == TagDepart) ? 0x80 : 0x00;
+        for(i = 0; i < event.uidLen; ++i) {
+            payload[i + 1] = event.uid[i];
+        }
+        LogRecord(LOG_UID, payload, event.uidLen + 1);
+        if(event.type != TagArrive) continue;
+
+        if(_module.pending) _module.superseded++;
+        for(i = 0; i < event.uidLen; ++i) {
+            _module.uid[i] = event.uid[i];
+        }
+        _module.uidLen = event.uidLen;
+        _module.seenAt = Cycles();
+        GetCardStats(&_module.card, &stats);
+        _module.detect = stats.lastLatency * 1000UL;
+        _module.pending = 1;
+        SchedulerMarkRunnable(_module.displayTask);
+    }
+}
+
+/* Pads to a full row so whatever was there before gets overwritten */
+void FormatName(char *line, const tagEntry_t *entry)
+{
+    const char *name = entry ? entry->name : "Unknown tag";
+    int i = 0;
+
+    for(; name[i] && i < 16; ++i) {
+        line[i] = name[i];
+    }
+    for(; i < 16; ++i) {
+        line[i] = ' ';
+    }
+    line[16] = 0;
+}
+
+void FormatUid(char *line, uint8_t *uid, uint8_t len)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    int i = 0;
+    int col = 0;
+
+    /* A 10 byte UID doesn't fit, the tail end gets cut off */
+    for(; i < len && col < 16; ++i) {
+        line[col++] = hex[uid[i] >> 4];
+        line[col++] = hex[uid[i] & 0x0F];
+    }
+    for(; col < 16; ++col) {
+        line[col] = ' ';
+    }
+    line[16] = 0;
+}
+
+/*
+ * Picks up the newest tag once the LCD has room, and notices when the text
+ * for the last one is all out. Never waits on either, so the reader keeps
+ * polling the whole time.
+ */
+void DisplayTask()
+{
+    char name[17];
+    char uid[17];
+    const tagEntry_t *entry;
+    unsigned long start;
+    unsigned long now;
+
+    if(_module.showing && !LcdBusy()) {
+        now = Cycles();
+        StageDone(StageDisplay, ToMicroseconds(now - _module.queuedAt));
+        StageDone(StageTotal, _module.detect + ToMicroseconds(now - _module.seenAt));
+        if(_module.stages[StageTotal].last > LATENCY_BUDGET * 1000UL) _module.overruns++;
+        _module.showing = 0;
+    }
+
+    if(!_module.pending || _module.showing || !Ready()) return;
+
+    start = Cycles();
+    StageDone(StageDetect, _module.detect);
+    StageDone(StageWait, ToMicroseconds(start - _module.seenAt));
+    _module.pending = 0;
+
+    entry = LookupTag(_module.uid, _module.uidLen);
+    now = Cycles();
+    StageDone(StageLookup, ToMicroseconds(now - start));
+
+    FormatName(name, entry);
+    FormatUid(uid, _module.uid, _module.uidLen);
+    PrintAt(0, 0, name);
+    PrintAt(0, 1, uid);
+    _module.queuedAt = Cycles();
+    StageDone(StageQueue, ToMicroseconds(_module.queuedAt - now));
+    _module.showing = 1;
+}
+
+/* Last and max of every stage in us, then budget overruns, as one LOG_LATENCY record */
+void ReportTask()
+{
+    unsigned long report[STAGE_COUNT * 2 + 1];
+    int i = 0;
+
+    for(; i < STAGE_COUNT; ++i) {
+        report[i * 2] = _module.stages[i].last;
+        report[i * 2 + 1] = _module.stages[i].max;
+    }
+    report[STAGE_COUNT * 2] = _module.overruns;
+    LogRecord(LOG_LATENCY, (uint8_t *) report, sizeof(report));
+}
+
+int main(void) {
+    AD1PCFGL = 0xFFFF; // No analog inputs, every pin is digital
+    InitScheduler(CLOCK_RATE);
+    InitTrace();
+    InitUART(CLOCK_RATE, LOG_BAUD);
+
+    InitI2C();
+    InitLcd();
+
+    InitializeSPIDriver();
+    InitReader(&_module.reader, &readerPins);
+    CardInit(&_module.card, &_module.reader);
+    TrackerInit(&_module.tracker, &_module.card);
+
+    _module.displayTask = TaskCreate(DisplayTask);
+    /* Ticks along too, to catch the LCD finishing */
+    TaskSchedule(_module.displayTask, 1, 1);
+
+    int readerTask = TaskCreate(ReaderTask);
+    TaskSchedule(readerTask, 1, 1);
+    SetIrqTask(readerTask);
+
+    TaskSchedule(TaskCreate(ReportTask), REPORT_PERIOD, REPORT_PERIOD);
+#if TRACE_ENABLE
+    TaskSchedule(TaskCreate(LogTrace), TRACE_PERIOD, TRACE_PERIOD);
+#endif
+#if BUS_CAPTURE
+    TaskSchedule(TaskCreate(LogCapture), CAPTURE_PERIOD, CAPTURE_PERIOD);
+#endif
+
+    while(1) {
+        SchedulerProcess();
+    }
+
+    return 0;
+}
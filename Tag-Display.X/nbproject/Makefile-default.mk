@@ -0,0 +1,343 @@
+#
+# Generated Makefile - do not edit!
+#
+# Edit the Makefile in the project folder instead (../Makefile). Each target
+# has a -pre and a -post target defined where you can add customized code.
+#
+# This makefile implements configuration specific macros and targets.
+
+
+# Include project Makefile
+ifeq "${IGNORE_LOCAL}" "TRUE"
+# do not include local makefile. User is passing all local related variables already
+else
+include Makefile
+# Include makefile containing local settings
+ifeq "$(wildcard nbproject/Makefile-local-default.mk)" "nbproject/Makefile-local-default.mk"
+include nbproject/Makefile-local-default.mk
+endif
+endif
+
+# Environment
+MKDIR=gnumkdir -p
+RM=rm -f 
+MV=mv 
+CP=cp 
+
+# Macros
+CND_CONF=default
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+IMAGE_TYPE=debug
+OUTPUT_SUFFIX=elf
+DEBUGGABLE_SUFFIX=elf
+FINAL_IMAGE=dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+else
+IMAGE_TYPE=production
+OUTPUT_SUFFIX=hex
+DEBUGGABLE_SUFFIX=elf
+FINAL_IMAGE=dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+endif
+
+ifeq ($(COMPARE_BUILD), true)
+COMPARISON_BUILD=-mafrlcsj
+else
+COMPARISON_BUILD=
+endif
+
+ifdef SUB_IMAGE_ADDRESS
+SUB_IMAGE_ADDRESS_COMMAND=--image-address $(SUB_IMAGE_ADDRESS)
+else
+SUB_IMAGE_ADDRESS_COMMAND=
+endif
+
+# Object Directory
+OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
+
+# Distribution Directory
+DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
+
+# Source Files Quoted if spaced
+SOURCEFILES_QUOTED_IF_SPACED=main.c tagTable.c ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c ../RFID-Reader.X/crcA.c ../RFID-Reader.X/tagTracker.c ../LCD-Demo.X/i2cDriver.c ../LCD-Demo.X/lcdDriver.c ../LCD-Demo.X/utils.c ../Common/scheduler.c ../Common/trace.c ../Common/uartDriver.c ../Common/busCapture.c
+
+# Object Files Quoted if spaced
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/tagTable.o ${OBJECTDIR}/_ext/556569156/spiDriver.o ${OBJECTDIR}/_ext/556569156/mfrc522.o ${OBJECTDIR}/_ext/556569156/iso14443a.o ${OBJECTDIR}/_ext/556569156/crcA.o ${OBJECTDIR}/_ext/556569156/tagTracker.o ${OBJECTDIR}/_ext/1161735932/i2cDriver.o ${OBJECTDIR}/_ext/1161735932/lcdDriver.o ${OBJECTDIR}/_ext/1161735932/utils.o ${OBJECTDIR}/_ext/2108356922/scheduler.o ${OBJECTDIR}/_ext/2108356922/trace.o ${OBJECTDIR}/_ext/2108356922/uartDriver.o ${OBJECTDIR}/_ext/2108356922/busCapture.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/tagTable.o.d ${OBJECTDIR}/_ext/556569156/spiDriver.o.d ${OBJECTDIR}/_ext/556569156/mfrc522.o.d ${OBJECTDIR}/_ext/556569156/iso14443a.o.d ${OBJECTDIR}/_ext/556569156/crcA.o.d ${OBJECTDIR}/_ext/556569156/tagTracker.o.d ${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d ${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d ${OBJECTDIR}/_ext/1161735932/utils.o.d ${OBJECTDIR}/_ext/2108356922/scheduler.o.d ${OBJECTDIR}/_ext/2108356922/trace.o.d ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d ${OBJECTDIR}/_ext/2108356922/busCapture.o.d
+
+# Object Files
+OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/tagTable.o ${OBJECTDIR}/_ext/556569156/spiDriver.o ${OBJECTDIR}/_ext/556569156/mfrc522.o ${OBJECTDIR}/_ext/556569156/iso14443a.o ${OBJECTDIR}/_ext/556569156/crcA.o ${OBJECTDIR}/_ext/556569156/tagTracker.o ${OBJECTDIR}/_ext/1161735932/i2cDriver.o ${OBJECTDIR}/_ext/1161735932/lcdDriver.o ${OBJECTDIR}/_ext/1161735932/utils.o ${OBJECTDIR}/_ext/2108356922/scheduler.o ${OBJECTDIR}/_ext/2108356922/trace.o ${OBJECTDIR}/_ext/2108356922/uartDriver.o ${OBJECTDIR}/_ext/2108356922/busCapture.o
+
+# Source Files
+SOURCEFILES=main.c tagTable.c ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c ../RFID-Reader.X/crcA.c ../RFID-Reader.X/tagTracker.c ../LCD-Demo.X/i2cDriver.c ../LCD-Demo.X/lcdDriver.c ../LCD-Demo.X/utils.c ../Common/scheduler.c ../Common/trace.c ../Common/uartDriver.c ../Common/busCapture.c
+
+
+
+CFLAGS=
+ASFLAGS=
+LDLIBSOPTIONS=
+
+############# Tool locations ##########################################
+# If you copy a project from one host to another, the path where the  #
+# compiler is installed may be different.                             #
+# If you open this project with MPLAB X in the new host, this         #
+# makefile will be regenerated and the paths will be corrected.       #
+#######################################################################
+# fixDeps replaces a bunch of sed/cat/printf statements that slow down the build
+FIXDEPS=fixDeps
+
+.build-conf:  ${BUILD_SUBPROJECTS}
+ifneq ($(INFORMATION_MESSAGE), )
+	@echo $(INFORMATION_MESSAGE)
+endif
+	${MAKE}  -f nbproject/Makefile-default.mk dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+
+MP_PROCESSOR_OPTION=33FJ128MC802
+MP_LINKER_FILE_OPTION=,--script=p33FJ128MC802.gld
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: compile
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/main.o.d 
+	@${RM} ${OBJECTDIR}/main.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  main.c  -o ${OBJECTDIR}/main.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/main.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/main.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/tagTable.o: tagTable.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/tagTable.o.d 
+	@${RM} ${OBJECTDIR}/tagTable.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  tagTable.c  -o ${OBJECTDIR}/tagTable.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/tagTable.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/tagTable.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/spiDriver.o: ../RFID-Reader.X/spiDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/spiDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/spiDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/spiDriver.c  -o ${OBJECTDIR}/_ext/556569156/spiDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/spiDriver.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/spiDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/mfrc522.o: ../RFID-Reader.X/mfrc522.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/mfrc522.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/mfrc522.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/mfrc522.c  -o ${OBJECTDIR}/_ext/556569156/mfrc522.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/mfrc522.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/mfrc522.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/iso14443a.o: ../RFID-Reader.X/iso14443a.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/iso14443a.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/iso14443a.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/iso14443a.c  -o ${OBJECTDIR}/_ext/556569156/iso14443a.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/iso14443a.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/iso14443a.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/crcA.o: ../RFID-Reader.X/crcA.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/crcA.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/crcA.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/crcA.c  -o ${OBJECTDIR}/_ext/556569156/crcA.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/crcA.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/crcA.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/tagTracker.o: ../RFID-Reader.X/tagTracker.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/tagTracker.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/tagTracker.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/tagTracker.c  -o ${OBJECTDIR}/_ext/556569156/tagTracker.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/tagTracker.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/tagTracker.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/i2cDriver.o: ../LCD-Demo.X/i2cDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/i2cDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/i2cDriver.c  -o ${OBJECTDIR}/_ext/1161735932/i2cDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/lcdDriver.o: ../LCD-Demo.X/lcdDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/lcdDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/lcdDriver.c  -o ${OBJECTDIR}/_ext/1161735932/lcdDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/utils.o: ../LCD-Demo.X/utils.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/utils.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/utils.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/utils.c  -o ${OBJECTDIR}/_ext/1161735932/utils.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/utils.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/utils.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/scheduler.o: ../Common/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/scheduler.c  -o ${OBJECTDIR}/_ext/2108356922/scheduler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/scheduler.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/scheduler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/trace.o: ../Common/trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/trace.c  -o ${OBJECTDIR}/_ext/2108356922/trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/trace.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/trace.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/uartDriver.o: ../Common/uartDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/uartDriver.c  -o ${OBJECTDIR}/_ext/2108356922/uartDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/busCapture.o: ../Common/busCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/busCapture.c  -o ${OBJECTDIR}/_ext/2108356922/busCapture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/busCapture.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1    -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/busCapture.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+else
+${OBJECTDIR}/main.o: main.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/main.o.d 
+	@${RM} ${OBJECTDIR}/main.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  main.c  -o ${OBJECTDIR}/main.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/main.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/main.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/tagTable.o: tagTable.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/tagTable.o.d 
+	@${RM} ${OBJECTDIR}/tagTable.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  tagTable.c  -o ${OBJECTDIR}/tagTable.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/tagTable.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/tagTable.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/spiDriver.o: ../RFID-Reader.X/spiDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/spiDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/spiDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/spiDriver.c  -o ${OBJECTDIR}/_ext/556569156/spiDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/spiDriver.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/spiDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/mfrc522.o: ../RFID-Reader.X/mfrc522.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/mfrc522.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/mfrc522.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/mfrc522.c  -o ${OBJECTDIR}/_ext/556569156/mfrc522.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/mfrc522.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/mfrc522.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/iso14443a.o: ../RFID-Reader.X/iso14443a.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/iso14443a.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/iso14443a.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/iso14443a.c  -o ${OBJECTDIR}/_ext/556569156/iso14443a.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/iso14443a.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/iso14443a.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/crcA.o: ../RFID-Reader.X/crcA.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/crcA.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/crcA.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/crcA.c  -o ${OBJECTDIR}/_ext/556569156/crcA.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/crcA.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/crcA.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/556569156/tagTracker.o: ../RFID-Reader.X/tagTracker.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/556569156" 
+	@${RM} ${OBJECTDIR}/_ext/556569156/tagTracker.o.d 
+	@${RM} ${OBJECTDIR}/_ext/556569156/tagTracker.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../RFID-Reader.X/tagTracker.c  -o ${OBJECTDIR}/_ext/556569156/tagTracker.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/556569156/tagTracker.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/556569156/tagTracker.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/i2cDriver.o: ../LCD-Demo.X/i2cDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/i2cDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/i2cDriver.c  -o ${OBJECTDIR}/_ext/1161735932/i2cDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/i2cDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/lcdDriver.o: ../LCD-Demo.X/lcdDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/lcdDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/lcdDriver.c  -o ${OBJECTDIR}/_ext/1161735932/lcdDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/lcdDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/1161735932/utils.o: ../LCD-Demo.X/utils.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1161735932" 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/utils.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1161735932/utils.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../LCD-Demo.X/utils.c  -o ${OBJECTDIR}/_ext/1161735932/utils.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/1161735932/utils.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1161735932/utils.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/scheduler.o: ../Common/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/scheduler.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/scheduler.c  -o ${OBJECTDIR}/_ext/2108356922/scheduler.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/scheduler.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/scheduler.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/trace.o: ../Common/trace.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/trace.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/trace.c  -o ${OBJECTDIR}/_ext/2108356922/trace.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/trace.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/trace.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/uartDriver.o: ../Common/uartDriver.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/uartDriver.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/uartDriver.c  -o ${OBJECTDIR}/_ext/2108356922/uartDriver.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/uartDriver.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+${OBJECTDIR}/_ext/2108356922/busCapture.o: ../Common/busCapture.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/2108356922" 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o.d 
+	@${RM} ${OBJECTDIR}/_ext/2108356922/busCapture.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  ../Common/busCapture.c  -o ${OBJECTDIR}/_ext/2108356922/busCapture.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MMD -MF "${OBJECTDIR}/_ext/2108356922/busCapture.o.d"        -g -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -O0 -msmart-io=1 -Wall -msfr-warn=off  
+	@${FIXDEPS} "${OBJECTDIR}/_ext/2108356922/busCapture.o.d" $(SILENT)  -rsi ${MP_CC_DIR}../ 
+	
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: assemble
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+else
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: assemblePreproc
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+else
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: link
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}: ${OBJECTFILES}  nbproject/Makefile-${CND_CONF}.mk    
+	@${MKDIR} dist/${CND_CONF}/${IMAGE_TYPE} 
+	${MP_CC} $(MP_EXTRA_LD_PRE)  -o dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}  ${OBJECTFILES_QUOTED_IF_SPACED}      -mcpu=$(MP_PROCESSOR_OPTION)        -D__DEBUG=__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)   -mreserve=data@0x800:0x81F -mreserve=data@0x820:0x821 -mreserve=data@0x822:0x823 -mreserve=data@0x824:0x825 -mreserve=data@0x826:0x84F   -Wl,,,--defsym=__MPLAB_BUILD=1,--defsym=__MPLAB_DEBUG=1,--defsym=__DEBUG=1,-D__DEBUG=__DEBUG,--defsym=__MPLAB_DEBUGGER_PK3=1,$(MP_LINKER_FILE_OPTION),--stack=16,--check-sections,--data-init,--pack-data,--handles,--isr,--no-gc-sections,--fill-upper=0,--stackguard=16,--no-force-link,--smart-io,-Map="${DISTDIR}/${PROJECTNAME}.${IMAGE_TYPE}.map",--report-mem,--memorysummary,dist/${CND_CONF}/${IMAGE_TYPE}/memoryfile.xml$(MP_EXTRA_LD_POST) 
+	
+else
+dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${OUTPUT_SUFFIX}: ${OBJECTFILES}  nbproject/Makefile-${CND_CONF}.mk   
+	@${MKDIR} dist/${CND_CONF}/${IMAGE_TYPE} 
+	${MP_CC} $(MP_EXTRA_LD_PRE)  -o dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${DEBUGGABLE_SUFFIX}  ${OBJECTFILES_QUOTED_IF_SPACED}      -mcpu=$(MP_PROCESSOR_OPTION)        -omf=elf -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -Wl,,,--defsym=__MPLAB_BUILD=1,$(MP_LINKER_FILE_OPTION),--stack=16,--check-sections,--data-init,--pack-data,--handles,--isr,--no-gc-sections,--fill-upper=0,--stackguard=16,--no-force-link,--smart-io,-Map="${DISTDIR}/${PROJECTNAME}.${IMAGE_TYPE}.map",--report-mem,--memorysummary,dist/${CND_CONF}/${IMAGE_TYPE}/memoryfile.xml$(MP_EXTRA_LD_POST) 
+	${MP_CC_DIR}\\xc16-bin2hex dist/${CND_CONF}/${IMAGE_TYPE}/Tag-Display.X.${IMAGE_TYPE}.${DEBUGGABLE_SUFFIX} -a  -omf=elf  
+	
+endif
+
+
+# Subprojects
+.build-subprojects:
+
+
+# Subprojects
+.clean-subprojects:
+
+# Clean Targets
+.clean-conf: ${CLEAN_SUBPROJECTS}
+	${RM} -r build/default
+	${RM} -r dist/default
+
+# Enable dependency checking
+.dep.inc: .depcheck-impl
+
+DEPFILES=$(shell mplabwildcard ${POSSIBLE_DEPFILES})
+ifneq (${DEPFILES},)
+include ${DEPFILES}
+endif
@@ -0,0 +1,59 @@
+/*
+ * File:   tagTable.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 10:15 PM
+ */
+
+
+#include "xc.h"
+#include "tagTable.h"
+
+/*
+ * Known tags, const so it stays in flash and is read through PSV. Has to be
+ * kept sorted by length and then by UID byte for the binary search.
+ */
+static const tagEntry_t tagTable[] = {
+    { 4, { 0x04, 0x1A, 0x2B, 0x3C }, "Front desk" },
+    { 4, { 0x3E, 0x91, 0x0C, 0x7A }, "Maintenance" },
+    { 4, { 0x8A, 0x22, 0x5D, 0xE1 }, "Visitor 1" },
+    { 4, { 0x8A, 0x22, 0x5D, 0xF3 }, "Visitor 2" },
+    { 4, { 0xC2, 0x7F, 0x40, 0x19 }, "Office" },
+    { 7, { 0x04, 0x31, 0x6B, 0x52, 0xA4, 0x5C, 0x80 }, "Lab door" },
+    { 7, { 0x04, 0x9E, 0x12, 0x3A, 0x71, 0x66, 0x81 }, "Spare badge" },
+};
+
+#define TAG_COUNT (sizeof(tagTable) / sizeof(tagTable[0]))
+
+/* Same sign convention as memcmp, length first */
+int CompareUid(const tagEntry_t *entry, const uint8_t *uid, uint8_t len)
+{
+    uint8_t i = 0;
+
+    if(entry->len != len) return (int) entry->len - len;
+    for(; i < len; ++i) {
+        if(entry->uid[i] != uid[i]) return (int) entry->uid[i] - uid[i];
+    }
+    return 0;
+}
+
+const tagEntry_t *LookupTag(const uint8_t *uid, uint8_t len)
+{
+    unsigned int lo = 0;
+    unsigned int hi = TAG_COUNT;
+
+    while(lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        int cmp = CompareUid(&tagTable[mid], uid, len);
+
+        if(cmp == 0) return &tagTable[mid];
+        if(cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return 0;
+}
+
+unsigned int TagCount()
+{
+    return TAG_COUNT;
+}
@@ -0,0 +1,29 @@
+
+#ifndef __TAG_TABLE_H_
+#define	__TAG_TABLE_H_
+
+#include <xc.h> // include processor files - each processor file is guarded.
+#include "../RFID-Reader.X/iso14443a.h"
+
+#define TAG_NAME_SIZE 17 // 16 columns and the terminator
+
+typedef struct {
+    uint8_t len;
+    uint8_t uid[UID_SIZE];
+    char name[TAG_NAME_SIZE];
+} tagEntry_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /* Returns the entry for uid, 0 if it isn't one of ours */
+    const tagEntry_t *LookupTag(const uint8_t *uid, uint8_t len);
+    unsigned int TagCount();
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* XC_HEADER_TEMPLATE_H */
+
@@ -0,0 +1,485 @@
+/*
+ * File:   busReplay.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 12:30 AM
+ *
+ * Replays a bus capture (Common/busCapture.h, as pulled out of the UART log
+ * with logDecode -c) against the firmware it came from, built for the host
+ * on the simulated chip in Tools/host. Every SPI chip select and I2C
+ * address in the capture gets a device that answers with the recorded
+ * bytes, in order, and checks the firmware sends what it sent on the board.
+ * A reader's IRQ pin falls when its next recorded window started, so the
+ * firmware gets to each one about when it did on the board. An I2C operation
+ * that failed is NACKed until the driver gives up on it, but NACKs it got
+ * past on a retry aren't in the capture, so those go through first time.
+ *
+ * Prints operations, bytes on the wire and busy time per bus, recorded
+ * against replayed, then every operation that went differently, and exits
+ * non-zero if any did. The firmware starts from reset, so the capture has
+ * to as well, with nothing dropped.
+ *
+ * The firmware's main() is renamed with -Dmain=FirmwareMain and run from
+ * here until the capture is done. lcdDriver spins on I2CProcess while it
+ * waits on the bus, which never moves the host clock, so the link wraps
+ * the calls from outside i2cDriver.c to wait for the next event first
+ * whenever the driver is waiting on the bus. For Tag-Display:
+ *
+ *   cc -fgnu89-inline -DBUS_CAPTURE=1 -Dmain=FirmwareMain -Wl,--wrap=I2CProcess -I host -o busReplay \
+ *       busReplay.c host/hostChip.c ../Tag-Display.X/main.c ../Tag-Display.X/tagTable.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c \
+ *       ../RFID-Reader.X/crcA.c ../RFID-Reader.X/tagTracker.c ../LCD-Demo.X/i2cDriver.c \
+ *       ../LCD-Demo.X/lcdDriver.c ../LCD-Demo.X/utils.c ../Common/scheduler.c ../Common/trace.c \
+ *       ../Common/uartDriver.c
+ *   ./busReplay capture.bin [fcy in Hz, default 3685000]
+ */
+
+#undef main
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "host/hostChip.h"
+#include "../Common/busCapture.h"
+#include "../Common/scheduler.h"
+
+#define HEADER_SIZE 11
+#define BUS_COUNT 2
+
+#define MAX_DEVICES 8
+#define MAX_REPORTED 10 // Differences printed, the rest are only counted
+#define END_MARGIN 10   // ms run past the last recorded operation, to catch anything extra
+
+typedef struct {
+    uint8_t flags;
+    uint8_t addr;
+    unsigned int len;
+    unsigned long start;
+    unsigned int duration;
+    const uint8_t *data;
+} op_t;
+
+/* Where each reader's IRQ goes, by chip-select address, wired as in RFID-Reader.X and Tag-Display.X */
+typedef struct {
+    uint8_t addr;
+    volatile unsigned int *port;
+    unsigned int mask;
+    volatile unsigned int *cnEnable;
+    unsigned int cnMask;
+} irqPin_t;
+
+static const irqPin_t irqPins[] = {
+    { 12,   &PORTB, 1 << 11, &CNEN1, 1 << 15 },
+    { 10,   &PORTB, 1 << 4,  &CNEN1, 1 << 1 },
+    { 2,    &PORTB, 1 << 3,  &CNEN1, 1 << 7 },
+    { 0x82, &PORTA, 1 << 4,  &CNEN1, 1 << 0 },
+};
+
+/* One chip select or I2C address and the recorded operations it owes */
+typedef struct {
+    uint8_t bus;
+    uint8_t addr;
+    const irqPin_t *irq;
+    int irqEvent;
+
+    unsigned long *ops; // Capture indices, in order
+    unsigned long cnt;
+    unsigned long next;
+
+    long cur;           // Operation being replayed, -1 when the capture had no more
+    unsigned int pos;   // Data bytes so far
+    uint64_t start;
+    unsigned open : 1;  // I2C addressed, and neither stopped nor given up on yet
+    unsigned differs : 1;
+} device_t;
+
+typedef struct {
+    unsigned long ops;
+    unsigned long bytes; // On the wire, I2C address byte included
+    uint64_t busy;       // Cycles
+    uint64_t first;
+    uint64_t last;
+} totals_t;
+
+static const char *busNames[BUS_COUNT] = { "i2c", "spi" };
+
+static struct {
+    uint8_t *raw;
+    op_t *ops;
+    unsigned long cnt;
+
+    device_t devices[MAX_DEVICES];
+    unsigned int deviceCnt;
+
+    totals_t recorded[BUS_COUNT];
+    totals_t replayed[BUS_COUNT];
+    unsigned long differences;
+    unsigned long extra;
+} _module;
+
+int FirmwareMain(void);
+
+/* i2cDriver.c, not in its header */
+int waitingOnBus();
+void __real_I2CProcess();
+
+/* A pass that would find nothing to do on the board first skips to the next event here */
+void __wrap_I2CProcess()
+{
+    if(waitingOnBus()) HostIdle();
+    __real_I2CProcess();
+}
+
+static unsigned long Long(const uint8_t *b)
+{
+    return b[0] | (b[1] << 8) | ((unsigned long) b[2] << 16) | ((unsigned long) b[3] << 24);
+}
+
+static uint8_t Bus(const op_t *op)
+{
+    return op->flags & 0x03;
+}
+
+static unsigned long WireBytes(const op_t *op)
+{
+    /* SPI data is tx, rx pairs, one byte clocked for each */
+    if(Bus(op) == BUS_SPI) return op->len / 2;
+    return op->len + 1;
+}
+
+static int LoadCapture(const char *path)
+{
+    FILE *f;
+    long size;
+    long i = 0;
+    unsigned int len;
+
+    f = fopen(path, "rb");
+    if(!f) {
+        perror(path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    _module.raw = malloc(size ? size : 1);
+    /* Every record is at least a header, so this is plenty */
+    _module.ops = malloc((size / HEADER_SIZE + 1) * sizeof(op_t));
+    if(!_module.raw || !_module.ops || fread(_module.raw, 1, size, f) != (size_t) size) {
+        fprintf(stderr, "%s: couldn't read\n", path);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    /* Anything that isn't a record means something was lost, and the replay would go wrong from there */
+    while(i + HEADER_SIZE <= size) {
+        const uint8_t *r = &_module.raw[i];
+        op_t *op = &_module.ops[_module.cnt];
+        len = r[3] | (r[4] << 8);
+        if(r[0] != CAPTURE_MARK || (r[1] & 0x03) >= BUS_COUNT || i + HEADER_SIZE + len > size) break;
+        op->flags = r[1];
+        op->addr = r[2];
+        op->len = len;
+        op->start = Long(&r[5]);
+        op->duration = r[9] | (r[10] << 8);
+        op->data = &r[HEADER_SIZE];
+        _module.cnt++;
+        i += HEADER_SIZE + len;
+    }
+    if(i != size) {
+        fprintf(stderr, "%s: not a clean capture at byte %ld\n", path, i);
+        return -1;
+    }
+    return 0;
+}
+
+/****** Differences *******/
+
+/* Only the first difference in an operation is reported, the rest tend to follow from it */
+static void Differs(device_t *dev, const char *fmt, ...)
+{
+    va_list args;
+
+    if(dev->differs) return;
+    dev->differs = 1;
+    _module.differences++;
+    if(_module.differences > MAX_REPORTED) return;
+    printf("%s %02X op %ld: ", busNames[dev->bus], dev->addr, dev->cur < 0 ? -1L : (long) dev->ops[dev->cur]);
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+}
+
+/* The start or the select, which is where the recording starts an operation */
+static uint64_t Opened(uint8_t bus)
+{
+    hostBusStats_t stats;
+
+    if(bus == BUS_I2C) GetHostI2cStats(&stats);
+    else GetHostBusStats(&stats);
+    return stats.opened;
+}
+
+/* Next recorded operation for the device, -1 if the firmware has gone past the capture */
+static void NextOp(device_t *dev)
+{
+    dev->pos = 0;
+    dev->differs = 0;
+    dev->start = Opened(dev->bus);
+    if(dev->next >= dev->cnt) {
+        dev->cur = -1;
+        _module.extra++;
+        if(_module.extra <= MAX_REPORTED) printf("%s %02X: operation past the end of the capture\n",
+                busNames[dev->bus], dev->addr);
+        return;
+    }
+    dev->cur = dev->next++;
+}
+
+/* Checks one byte that went out against the recording, and hands back what came in */
+static uint8_t Replay(device_t *dev, uint8_t sent, unsigned int stride)
+{
+    const op_t *op;
+    unsigned int i = dev->pos * stride;
+
+    dev->pos++;
+    if(dev->cur < 0) return 0xFF;
+    op = &_module.ops[dev->ops[dev->cur]];
+    if(i + stride > op->len) {
+        if(!(op->flags & CAPTURE_TRUNCATED)) Differs(dev, "longer than the %u bytes recorded", op->len / stride);
+        return 0xFF;
+    }
+    if(stride == 2 || !(op->flags & CAPTURE_READ)) {
+        if(op->data[i] != sent) Differs(dev, "byte %u went out as %02X, recorded %02X", dev->pos - 1, sent, op->data[i]);
+    }
+    return op->data[i + stride - 1];
+}
+
+static void Finished(device_t *dev, unsigned int stride)
+{
+    const op_t *op;
+    totals_t *t = &_module.replayed[dev->bus];
+    uint64_t now = HostNow();
+
+    if(!t->ops) t->first = dev->start;
+    t->last = now;
+    t->ops++;
+    t->bytes += dev->pos + (dev->bus == BUS_I2C);
+    t->busy += now - dev->start;
+
+    if(dev->cur < 0) return;
+    op = &_module.ops[dev->ops[dev->cur]];
+    if(dev->pos * stride < op->len) Differs(dev, "shorter than the %u bytes recorded", op->len / stride);
+}
+
+/****** SPI *******/
+
+static void IrqFall(void *ctx)
+{
+    device_t *dev = ctx;
+
+    dev->irqEvent = -1;
+    HostSetPin(dev->irq->port, dev->irq->mask, 0, dev->irq->cnEnable, dev->irq->cnMask);
+}
+
+static void SpiSelect(void *ctx)
+{
+    device_t *dev = ctx;
+
+    /* Whatever the reader raised is being dealt with now */
+    if(dev->irq) {
+        HostCancel(dev->irqEvent);
+        dev->irqEvent = -1;
+        HostSetPin(dev->irq->port, dev->irq->mask, 1, dev->irq->cnEnable, dev->irq->cnMask);
+    }
+    NextOp(dev);
+}
+
+static uint8_t SpiExchange(void *ctx, uint8_t tx)
+{
+    return Replay(ctx, tx, 2);
+}
+
+static void SpiDeselect(void *ctx)
+{
+    device_t *dev = ctx;
+    long wait;
+
+    Finished(dev, 2);
+    if(!dev->irq || dev->next >= dev->cnt) return;
+    /* Board and host clocks both start at reset, so the recorded start is when the reader called */
+    wait = (long)(int32_t)(_module.ops[dev->ops[dev->next]].start - Cycles());
+    dev->irqEvent = HostAt(HostNow() + (wait > 0 ? wait : 0), IrqFall, dev);
+}
+
+/****** I2C *******/
+
+static int I2cStart(void *ctx, int read)
+{
+    device_t *dev = ctx;
+    const op_t *op;
+
+    /* A retry comes without a stop and picks up where the NACK left off, still the same operation */
+    if(!dev->open) NextOp(dev);
+    dev->open = 1;
+    /* but the recording starts over on it */
+    dev->start = Opened(BUS_I2C);
+    if(dev->cur < 0) return 1;
+    op = &_module.ops[dev->ops[dev->cur]];
+    if(read != !!(op->flags & CAPTURE_READ)) Differs(dev, "went out as a %s", read ? "read" : "write");
+    /* One that failed with nothing sent was NACKed at the address */
+    return !(op->flags & CAPTURE_FAILED) || op->len > 0;
+}
+
+static int I2cWrite(void *ctx, uint8_t b)
+{
+    device_t *dev = ctx;
+    const op_t *op;
+
+    /* Only bytes that were ACKed are recorded, so on a failed one the byte after them was refused */
+    if(dev->cur >= 0) {
+        op = &_module.ops[dev->ops[dev->cur]];
+        if((op->flags & (CAPTURE_FAILED | CAPTURE_TRUNCATED)) == CAPTURE_FAILED && dev->pos >= op->len) return 0;
+    }
+    Replay(dev, b, 1);
+    return 1;
+}
+
+static uint8_t I2cRead(void *ctx)
+{
+    return Replay(ctx, 0, 1);
+}
+
+static void I2cStop(void *ctx)
+{
+    device_t *dev = ctx;
+
+    dev->open = 0;
+    Finished(dev, 1);
+}
+
+/****** Report *******/
+
+static void PrintTotals(const char *what, const totals_t *t, unsigned long fcy)
+{
+    printf("  %-8s %7lu ops %9lu bytes %11.1f us busy, over %9.1f ms\n", what, t->ops, t->bytes,
+            t->busy * 1000000.0 / fcy, t->ops ? (t->last - t->first) * 1000.0 / fcy : 0.0);
+}
+
+static void Report(void *ctx)
+{
+    unsigned long fcy = HostFcy();
+    unsigned long missing = 0;
+    unsigned int i = 0;
+    uint8_t b = 0;
+
+    for(; i < _module.deviceCnt; ++i) {
+        missing += _module.devices[i].cnt - _module.devices[i].next;
+    }
+    for(; b < BUS_COUNT; ++b) {
+        if(!_module.recorded[b].ops && !_module.replayed[b].ops) continue;
+        printf("%s\n", busNames[b]);
+        PrintTotals("recorded", &_module.recorded[b], fcy);
+        PrintTotals("replayed", &_module.replayed[b], fcy);
+    }
+    if(_module.differences > MAX_REPORTED) printf("... and %lu more differences\n", _module.differences - MAX_REPORTED);
+    if(missing) printf("%lu recorded operations never came\n", missing);
+    if(_module.differences || _module.extra || missing) {
+        printf("traffic differs\n");
+        exit(1);
+    }
+    printf("traffic matches\n");
+    exit(0);
+}
+
+/****** Setup *******/
+
+static device_t *Device(uint8_t bus, uint8_t addr)
+{
+    device_t *dev;
+    unsigned int i = 0;
+
+    for(; i < _module.deviceCnt; ++i) {
+        dev = &_module.devices[i];
+        if(dev->bus == bus && dev->addr == addr) return dev;
+    }
+    if(_module.deviceCnt >= MAX_DEVICES) return 0;
+    dev = &_module.devices[_module.deviceCnt++];
+    dev->bus = bus;
+    dev->addr = addr;
+    dev->irqEvent = -1;
+    dev->ops = malloc(_module.cnt * sizeof(unsigned long));
+    if(bus != BUS_SPI) return dev;
+    for(i = 0; i < sizeof(irqPins) / sizeof(irqPins[0]); ++i) {
+        if(irqPins[i].addr == addr) dev->irq = &irqPins[i];
+    }
+    return dev;
+}
+
+static int Attach()
+{
+    unsigned long i = 0;
+    unsigned int d;
+
+    for(; i < _module.cnt; ++i) {
+        const op_t *op = &_module.ops[i];
+        totals_t *t = &_module.recorded[Bus(op)];
+        device_t *dev = Device(Bus(op), op->addr);
+
+        if(!dev) {
+            fprintf(stderr, "more than %u devices in the capture\n", MAX_DEVICES);
+            return -1;
+        }
+        dev->ops[dev->cnt++] = i;
+        if(!t->ops || op->start < t->first) t->first = op->start;
+        if(op->start + op->duration > t->last) t->last = op->start + op->duration;
+        t->ops++;
+        t->bytes += WireBytes(op);
+        t->busy += op->duration;
+    }
+    for(d = 0; d < _module.deviceCnt; ++d) {
+        device_t *dev = &_module.devices[d];
+        if(dev->bus == BUS_SPI) {
+            hostSpiDevice_t spi = { SpiSelect, SpiExchange, SpiDeselect, dev };
+            HostSpiAttach(dev->addr, &spi);
+            /* IRQ idles high until the first command */
+            if(dev->irq) HostSetPin(dev->irq->port, dev->irq->mask, 1, dev->irq->cnEnable, dev->irq->cnMask);
+        } else {
+            hostI2cDevice_t i2c = { I2cStart, I2cWrite, I2cRead, I2cStop, I2cStop, dev };
+            HostI2cAttach(dev->addr, &i2c);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long fcy = 3685000;
+    uint64_t end = 0;
+    uint8_t b = 0;
+
+    if(argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s capture.bin [fcy in Hz, default 3685000]\n", argv[0]);
+        return 1;
+    }
+    if(argc == 3) fcy = strtoul(argv[2], 0, 0);
+    if(LoadCapture(argv[1]) < 0) return 1;
+    if(_module.cnt == 0) {
+        fprintf(stderr, "%s: no operations\n", argv[1]);
+        return 1;
+    }
+
+    HostInit(fcy);
+    if(Attach() < 0) return 1;
+    for(; b < BUS_COUNT; ++b) {
+        if(_module.recorded[b].last > end) end = _module.recorded[b].last;
+    }
+    HostAt(end + (uint64_t) END_MARGIN * fcy / 1000, Report, 0);
+
+    /* Never comes back, Report ends the run */
+    FirmwareMain();
+    return 1;
+}
@@ -0,0 +1,327 @@
+/*
+ * File:   busReport.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:40 PM
+ *
+ * Host side report for bus captures (Common/busCapture.h), as pulled out of
+ * the UART log with logDecode -c. Prints every operation and then totals per
+ * bus and per device: operations, bytes on the wire and time the bus was
+ * busy. Given a baseline capture with -c it also prints the difference and
+ * checks the firmware put the same traffic on the wire, operation by
+ * operation, so a driver change can be held up against a recorded workload.
+ *
+ *   cc -o busReport busReport.c
+ *   ./busReport capture.bin [fcy in Hz, default 3685000] [-c baseline.bin] [-q]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// Same layout as Common/busCapture.h
+#define CAPTURE_MARK      0xC5
+#define CAPTURE_TRUNCATED 0x20
+#define CAPTURE_FAILED    0x40
+#define CAPTURE_READ      0x80
+#define HEADER_SIZE 11
+
+#define BUS_I2C 0
+#define BUS_SPI 1
+#define BUS_COUNT 2
+
+#define MAX_DEVICES 32
+
+typedef struct {
+    uint8_t flags;
+    uint8_t addr;
+    unsigned int len;
+    unsigned long start;
+    unsigned int duration;
+    const uint8_t *data;
+} op_t;
+
+typedef struct {
+    uint8_t *raw;
+    op_t *ops;
+    unsigned long cnt;
+    unsigned long skipped; // Bytes thrown away looking for a record
+} capture_t;
+
+typedef struct {
+    uint8_t bus;
+    uint8_t addr;
+    unsigned long ops;
+    unsigned long failed;
+    unsigned long truncated;
+    unsigned long bytes; // On the wire, I2C address byte included
+    unsigned long busy;  // Cycles
+    unsigned int maxDuration;
+} totals_t;
+
+static const char *busNames[BUS_COUNT] = { "i2c", "spi" };
+
+static double _fcy = 3685000.0;
+
+unsigned long Long(const uint8_t *b)
+{
+    return b[0] | (b[1] << 8) | ((unsigned long) b[2] << 16) | ((unsigned long) b[3] << 24);
+}
+
+double Us(unsigned long cycles)
+{
+    return cycles * 1000000.0 / _fcy;
+}
+
+uint8_t Bus(const op_t *op)
+{
+    return op->flags & 0x03;
+}
+
+unsigned long WireBytes(const op_t *op)
+{
+    /* SPI data is tx, rx pairs, one byte clocked for each */
+    if(Bus(op) == BUS_SPI) return op->len / 2;
+    return op->len + 1;
+}
+
+int LoadCapture(const char *path, capture_t *cap)
+{
+    FILE *f;
+    long size;
+    long i = 0;
+    unsigned int len;
+
+    memset(cap, 0, sizeof(*cap));
+    f = fopen(path, "rb");
+    if(!f) {
+        perror(path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    cap->raw = malloc(size ? size : 1);
+    /* Every record is at least a header, so this is plenty */
+    cap->ops = malloc((size / HEADER_SIZE + 1) * sizeof(op_t));
+    if(!cap->raw || !cap->ops || fread(cap->raw, 1, size, f) != (size_t) size) {
+        fprintf(stderr, "%s: couldn't read\n", path);
+        fclose(f);
+        return -1;
+    }
+    fclose(f);
+
+    while(i + HEADER_SIZE <= size) {
+        const uint8_t *r = &cap->raw[i];
+        len = r[3] | (r[4] << 8);
+        if(r[0] != CAPTURE_MARK || (r[1] & 0x03) >= BUS_COUNT || i + HEADER_SIZE + len > size) {
+            cap->skipped++;
+            i++;
+            continue;
+        }
+        op_t *op = &cap->ops[cap->cnt++];
+        op->flags = r[1];
+        op->addr = r[2];
+        op->len = len;
+        op->start = Long(&r[5]);
+        op->duration = r[9] | (r[10] << 8);
+        op->data = &r[HEADER_SIZE];
+        i += HEADER_SIZE + len;
+    }
+    cap->skipped += size - i;
+    return 0;
+}
+
+void PrintOp(const op_t *op)
+{
+    unsigned int i = 0;
+
+    printf("%10.1f us  %s %02X %-5s %6.1f us ", Us(op->start), busNames[Bus(op)], op->addr,
+            (op->flags & CAPTURE_FAILED) ? "fail" : (op->flags & CAPTURE_READ) ? "read" : "write", Us(op->duration));
+    if(Bus(op) == BUS_SPI) {
+        /* Sent bytes, then what came back */
+        for(i = 0; i + 1 < op->len; i += 2) printf("%02X", op->data[i]);
+        printf(" / ");
+        for(i = 1; i < op->len; i += 2) printf("%02X", op->data[i]);
+    } else {
+        for(; i < op->len; ++i) printf("%02X", op->data[i]);
+    }
+    if(op->flags & CAPTURE_TRUNCATED) printf(" ...");
+    printf("\n");
+}
+
+/* Fills per bus totals, then per device totals, returns how many devices */
+unsigned int Tally(const capture_t *cap, totals_t *buses, totals_t *devices)
+{
+    unsigned int devCnt = 0;
+    unsigned long i = 0;
+    unsigned int d;
+
+    memset(buses, 0, BUS_COUNT * sizeof(totals_t));
+    for(; i < cap->cnt; ++i) {
+        const op_t *op = &cap->ops[i];
+        totals_t *t[2];
+
+        for(d = 0; d < devCnt; ++d) {
+            if(devices[d].bus == Bus(op) && devices[d].addr == op->addr) break;
+        }
+        if(d == devCnt && devCnt < MAX_DEVICES) {
+            memset(&devices[d], 0, sizeof(totals_t));
+            devices[d].bus = Bus(op);
+            devices[d].addr = op->addr;
+            devCnt++;
+        }
+        t[0] = &buses[Bus(op)];
+        t[1] = d < devCnt ? &devices[d] : t[0];
+        for(d = 0; d < 2; ++d) {
+            if(d == 1 && t[1] == t[0]) break;
+            t[d]->ops++;
+            if(op->flags & CAPTURE_FAILED) t[d]->failed++;
+            if(op->flags & CAPTURE_TRUNCATED) t[d]->truncated++;
+            t[d]->bytes += WireBytes(op);
+            t[d]->busy += op->duration;
+            if(op->duration > t[d]->maxDuration) t[d]->maxDuration = op->duration;
+        }
+    }
+    return devCnt;
+}
+
+void PrintTotals(const char *name, const totals_t *t)
+{
+    printf("%-8s %7lu ops %9lu bytes %10.1f us busy, %7.1f us avg, %7.1f us max", name, t->ops, t->bytes,
+            Us(t->busy), t->ops ? Us(t->busy) / t->ops : 0.0, Us(t->maxDuration));
+    if(t->failed) printf(", %lu failed", t->failed);
+    if(t->truncated) printf(", %lu cut off", t->truncated);
+    printf("\n");
+}
+
+void Report(const char *title, const capture_t *cap, totals_t *buses)
+{
+    totals_t devices[MAX_DEVICES];
+    unsigned int devCnt = Tally(cap, buses, devices);
+    unsigned long span = 0;
+    unsigned int b = 0;
+    unsigned int d;
+    char name[16];
+
+    if(cap->cnt > 1) span = (uint32_t)(cap->ops[cap->cnt - 1].start - cap->ops[0].start);
+
+    printf("\n%s: %lu operations over %.1f ms", title, cap->cnt, Us(span) / 1000.0);
+    if(cap->skipped) printf(", %lu bytes skipped", cap->skipped);
+    printf("\n");
+    for(; b < BUS_COUNT; ++b) {
+        if(!buses[b].ops) continue;
+        PrintTotals(busNames[b], &buses[b]);
+        for(d = 0; d < devCnt; ++d) {
+            if(devices[d].bus != b) continue;
+            snprintf(name, sizeof(name), "  %02X", devices[d].addr);
+            PrintTotals(name, &devices[d]);
+        }
+        if(span) printf("  %.0f bytes/s, %.2f%% of the time busy\n", buses[b].bytes / (Us(span) / 1000000.0),
+                100.0 * buses[b].busy / span);
+    }
+}
+
+/* What the firmware decided to send, responses and timing left out */
+int SameTraffic(const op_t *a, const op_t *b)
+{
+    unsigned int i = 0;
+
+    if(((a->flags ^ b->flags) & (CAPTURE_READ | 0x03)) || a->addr != b->addr || a->len != b->len) return 0;
+    if(Bus(a) == BUS_I2C && (a->flags & CAPTURE_READ)) return 1;
+    for(; i < a->len; i += Bus(a) == BUS_SPI ? 2 : 1) {
+        if(a->data[i] != b->data[i]) return 0;
+    }
+    return 1;
+}
+
+/* Walks each bus on its own, the order across buses depends on timing */
+void CompareTraffic(const capture_t *cap, const capture_t *base)
+{
+    unsigned int b = 0;
+
+    printf("\ntraffic against baseline:\n");
+    for(; b < BUS_COUNT; ++b) {
+        unsigned long i = 0;
+        unsigned long j = 0;
+        unsigned long matched = 0;
+
+        for(;;) {
+            while(i < cap->cnt && Bus(&cap->ops[i]) != b) i++;
+            while(j < base->cnt && Bus(&base->ops[j]) != b) j++;
+            if(i >= cap->cnt || j >= base->cnt) break;
+            if(!SameTraffic(&cap->ops[i], &base->ops[j])) {
+                printf("%s: differs at operation %lu\n  now  ", busNames[b], matched);
+                PrintOp(&cap->ops[i]);
+                printf("  was  ");
+                PrintOp(&base->ops[j]);
+                break;
+            }
+            matched++;
+            i++;
+            j++;
+        }
+        if(i >= cap->cnt && j >= base->cnt) {
+            if(matched) printf("%s: all %lu operations match\n", busNames[b], matched);
+        } else if(i >= cap->cnt || j >= base->cnt) {
+            printf("%s: first %lu operations match, then the %s runs out\n", busNames[b], matched,
+                    i >= cap->cnt ? "capture" : "baseline");
+        }
+    }
+}
+
+void PrintChange(const char *what, double now, double was)
+{
+    printf("  %-6s %12.1f -> %12.1f", what, was, now);
+    if(was != 0) printf("  %+.1f%%", 100.0 * (now - was) / was);
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    capture_t cap;
+    capture_t base;
+    totals_t buses[BUS_COUNT];
+    totals_t baseBuses[BUS_COUNT];
+    const char *path = 0;
+    const char *basePath = 0;
+    int quiet = 0;
+    unsigned long i = 0;
+    unsigned int b = 0;
+    int n;
+
+    for(n = 1; n < argc; ++n) {
+        if(strcmp(argv[n], "-c") == 0 && n + 1 < argc) basePath = argv[++n];
+        else if(strcmp(argv[n], "-q") == 0) quiet = 1;
+        else if(!path) path = argv[n];
+        else _fcy = strtod(argv[n], 0);
+    }
+    if(!path || _fcy <= 0) {
+        fprintf(stderr, "usage: %s capture.bin [fcy] [-c baseline.bin] [-q]\n", argv[0]);
+        return 1;
+    }
+
+    if(LoadCapture(path, &cap) < 0) return 1;
+    if(!quiet) {
+        for(; i < cap.cnt; ++i) PrintOp(&cap.ops[i]);
+    }
+    Report(path, &cap, buses);
+
+    if(basePath) {
+        if(LoadCapture(basePath, &base) < 0) return 1;
+        Report(basePath, &base, baseBuses);
+
+        printf("\nchange from baseline:\n");
+        for(; b < BUS_COUNT; ++b) {
+            if(!buses[b].ops && !baseBuses[b].ops) continue;
+            printf("%s\n", busNames[b]);
+            PrintChange("ops", buses[b].ops, baseBuses[b].ops);
+            PrintChange("bytes", buses[b].bytes, baseBuses[b].bytes);
+            PrintChange("us", Us(buses[b].busy), Us(baseBuses[b].busy));
+        }
+        CompareTraffic(&cap, &base);
+    }
+    return 0;
+}
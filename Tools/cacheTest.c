@@ -0,0 +1,155 @@
+/*
+ * File:   cacheTest.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 12:15 AM
+ *
+ * Checks the MFRC522 driver's shadow register cache against the MFRC522
+ * model in Tools/host. The card pipeline and the random pool run as they do
+ * in RFID-Reader.X/main.c, with several tags in each field so anticollision
+ * gets exercised, and after every step:
+ *   - every register the driver holds as cached matches the model's
+ *   - every register the model has changed on its own is one IsVolatile()
+ *     keeps out of the cache
+ *
+ *   cc -DBUS_CAPTURE=1 -I host -o cacheTest cacheTest.c host/hostChip.c host/mfrc522Model.c host/hostReaders.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c \
+ *       ../RFID-Reader.X/crcA.c ../RFID-Reader.X/random.c ../Common/scheduler.c
+ *   ./cacheTest [-s seconds]
+ *
+ * Exits non-zero on the first mismatch.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host/hostChip.h"
+#include "host/mfrc522Model.h"
+#include "host/hostReaders.h"
+#include "../RFID-Reader.X/global.h"
+#include "../RFID-Reader.X/spiDriver.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/iso14443a.h"
+#include "../RFID-Reader.X/random.h"
+#include "../Common/scheduler.h"
+
+#define READERS 2
+#define TAGS 3
+
+/* mfrc522.c, not in the header */
+int IsVolatile(uint8_t reg);
+
+static struct {
+    mfrc522Model_t chips[READERS];
+    mfrc522_t readers[READERS];
+    cardReader_t cards[READERS];
+
+    unsigned long checks;
+    unsigned long reads;
+    int failed;
+} _module;
+
+static void Replace(mfrc522Model_t *m, modelTag_t *tag)
+{
+    ModelRenewTag(m, tag);
+}
+
+static void Check(unsigned int i, const char *after)
+{
+    const mfrc522_t *rdr = &_module.readers[i];
+    const mfrc522Model_t *m = &_module.chips[i];
+    unsigned int reg = 0;
+
+    if(_module.failed) return;
+    _module.checks++;
+    for(; reg < REGISTER_COUNT; ++reg) {
+        int cached = (rdr->valid[reg >> 4] >> (reg & 0x0F)) & 0x01;
+        int changed = (m->changed[reg >> 4] >> (reg & 0x0F)) & 0x01;
+
+        if(cached && rdr->shadow[reg] != m->regs[reg]) {
+            printf("FAIL reader %u after %s: register %02X cached as %02X, chip holds %02X\n",
+                    i, after, reg, rdr->shadow[reg], m->regs[reg]);
+            _module.failed = 1;
+            return;
+        }
+        if(changed && !IsVolatile(reg)) {
+            printf("FAIL reader %u after %s: chip changed register %02X on its own, but it is cached\n",
+                    i, after, reg);
+            _module.failed = 1;
+            return;
+        }
+    }
+}
+
+/* Same shape as ReaderTask in RFID-Reader.X/main.c, without the tracker */
+static void ReaderTask()
+{
+    uint8_t uid[UID_SIZE];
+    unsigned int i = 0;
+
+    for(; i < READERS; ++i) {
+        if(i == 0 && RandomBusy()) continue;
+        CardProcess(&_module.cards[i]);
+        Check(i, "CardProcess");
+        if(GetCardUid(&_module.cards[i], uid)) _module.reads++;
+    }
+    if(CardIdle(&_module.cards[0])) {
+        RandomProcess();
+        Check(0, "RandomProcess");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int seconds = 5;
+    unsigned int i = 0;
+    unsigned int t;
+    uint8_t dat[RANDOM_POOL_SIZE];
+    uint64_t end;
+    int task;
+
+    if(argc == 3 && strcmp(argv[1], "-s") == 0) seconds = atoi(argv[2]);
+    else if(argc != 1) seconds = 0;
+    if(seconds == 0) {
+        fprintf(stderr, "usage: %s [-s seconds]\n", argv[0]);
+        return 1;
+    }
+
+    HostReadersInit();
+    for(; i < READERS; ++i) {
+        mfrc522Model_t *m = &_module.chips[i];
+
+        HostReaderAttach(i, m, &_module.readers[i], 0x1234 + i);
+        Check(i, "InitReader");
+        m->halted = Replace;
+        for(t = 0; t < TAGS; ++t) ModelNewTag(m, t == 0 ? 4 : 7);
+        CardInit(&_module.cards[i], &_module.readers[i]);
+        Check(i, "CardInit");
+        SetPollInterval(&_module.cards[i], 0);
+    }
+    InitRandom(&_module.readers[0]);
+    task = TaskCreate(ReaderTask);
+    TaskSchedule(task, 1, 1);
+    SetIrqTask(task);
+
+    end = HostNow() + (uint64_t) seconds * HostFcy();
+    while(HostNow() < end && !_module.failed) {
+        SchedulerProcess();
+        /* Keep the pool draining so it keeps refilling */
+        RandomBytes(dat, sizeof(dat));
+    }
+    if(_module.failed) return 1;
+
+    printf("%u s simulated, %lu checks, %lu tags read, %lu random bytes\n", seconds, _module.checks,
+            _module.reads, RandomGenerated());
+    for(i = 0; i < READERS; ++i) {
+        printf("reader %u: %lu accesses answered from the cache, chip changed", i, _module.readers[i].saved);
+        for(t = 0; t < REGISTER_COUNT; ++t) {
+            if((_module.chips[i].changed[t >> 4] >> (t & 0x0F)) & 0x01) printf(" %02X", t);
+        }
+        printf("\n");
+    }
+    printf("OK\n");
+    return 0;
+}
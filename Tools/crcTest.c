@@ -0,0 +1,180 @@
+/*
+ * File:   crcTest.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:59 PM
+ *
+ * Checks RFID-Reader.X/crcA.c against known CRC_A vectors and a plain
+ * bitwise CRC over random frames. Build it once per backend. The
+ * coprocessor build runs CalcCRC on the MFRC522 model in Tools/host, checks
+ * a lost IRQ times out without handing back a stale result, and also
+ * prints what each length costs on the bus.
+ *
+ *   cc -DBUS_CAPTURE=1 -DCRC_A_BACKEND=0 -I host -o crcTest crcTest.c host/hostChip.c host/mfrc522Model.c host/hostReaders.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/crcA.c ../Common/scheduler.c
+ *   ./crcTest
+ *
+ * and the same with -DCRC_A_BACKEND=1 for the coprocessor. Exits non-zero
+ * on the first mismatch.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host/hostChip.h"
+#include "host/mfrc522Model.h"
+#include "host/hostReaders.h"
+#include "../RFID-Reader.X/global.h"
+#include "../RFID-Reader.X/spiDriver.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/crcA.h"
+#include "../Common/scheduler.h"
+
+#define RANDOM_FRAMES 1000
+#define MAX_LEN 64 // The coprocessor takes the frame through the FIFO
+
+/* ISO 14443-3 frames, with the two CRC bytes as they go out on air, low byte first */
+typedef struct {
+    uint8_t dat[2];
+    uint8_t crc[2];
+} vector_t;
+
+static const vector_t vectors[] = {
+    { { 0x00, 0x00 }, { 0xA0, 0x1E } },
+    { { 0x12, 0x34 }, { 0x26, 0xCF } },
+    { { 0x50, 0x00 }, { 0x57, 0xCD } }, // HLTA
+};
+
+static struct {
+    mfrc522Model_t chip;
+    mfrc522_t rdr;
+    uint32_t seed;
+} _module;
+
+/* One bit at a time straight from the polynomial, nothing shared with either backend */
+static uint16_t BitwiseCrcA(const uint8_t *dat, unsigned int len)
+{
+    uint16_t crc = 0x6363;
+    unsigned int i;
+
+    for(; len > 0; --len) {
+        crc ^= *dat++;
+        for(i = 0; i < 8; ++i) {
+            crc = (crc & 0x0001) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static uint8_t NextByte()
+{
+    _module.seed = _module.seed * 1103515245 + 12345;
+    return _module.seed >> 16;
+}
+
+/*
+ * Runs one CRC_A to the end, the firmware would get on with other work
+ * meanwhile. Only a pass that didn't touch the bus idles, the same as the
+ * scheduler only sleeping with nothing runnable.
+ */
+static enum commandStatus CalcCrc(mfrc522_t *rdr, const uint8_t *dat, unsigned int len, uint16_t *crc)
+{
+    enum commandStatus st;
+    uint64_t pass;
+
+    if(StartCrcA(rdr, dat, len, crc) < 0) return CommandTimeout;
+    for(;;) {
+        pass = HostNow();
+        if((st = CrcAProcess(rdr, crc)) != CommandBusy) return st;
+        if(HostNow() == pass) Idle();
+    }
+}
+
+static int Check(const char *what, uint8_t *dat, unsigned int len, uint16_t want)
+{
+    uint16_t got = ~want;
+
+    if(CalcCrc(&_module.rdr, dat, len, &got) != CommandDone) {
+        printf("FAIL %s, %u bytes: no result\n", what, len);
+        return -1;
+    }
+    if(got == want) return 0;
+    printf("FAIL %s, %u bytes: got %02X %02X, want %02X %02X\n", what, len,
+            got & 0xFF, got >> 8, want & 0xFF, want >> 8);
+    return -1;
+}
+
+#if CRC_A_BACKEND == CRC_A_COPROCESSOR
+
+/* A CalcCRC whose IRQ never arrives has to come back without the last result */
+static int CheckTimeout()
+{
+    static const uint8_t dat[] = { 0x12, 0x34 };
+    unsigned int irqMask = _module.chip.irqMask;
+    uint16_t crc = 0;
+    enum commandStatus st;
+
+    _module.chip.irqMask = 0;
+    st = CalcCrc(&_module.rdr, dat, sizeof(dat), &crc);
+    _module.chip.irqMask = irqMask;
+    if(st == CommandTimeout && crc == 0) return 0;
+    printf("FAIL lost IRQ: status %d, crc %04X\n", st, crc);
+    return -1;
+}
+
+/* Bus time the coprocessor takes for one frame, to hold against the table */
+static void Cost()
+{
+    static const unsigned int lens[] = { 1, 2, 7, 16, 32, 64 };
+    uint8_t dat[MAX_LEN] = { 0 };
+    hostBusStats_t before;
+    hostBusStats_t after;
+    uint64_t start;
+    uint16_t crc;
+    unsigned int i = 0;
+
+    printf("\nbytes  SPI bytes  cycles\n");
+    for(; i < sizeof(lens) / sizeof(lens[0]); ++i) {
+        GetHostBusStats(&before);
+        start = HostNow();
+        CalcCrc(&_module.rdr, dat, lens[i], &crc);
+        GetHostBusStats(&after);
+        printf("%5u  %9lu  %6lu\n", lens[i], after.bytes - before.bytes, (unsigned long)(HostNow() - start));
+    }
+}
+
+#endif
+
+int main()
+{
+    uint8_t dat[MAX_LEN];
+    unsigned int i = 0;
+    unsigned int n;
+    unsigned int len;
+
+    HostReadersInit();
+    HostReaderAttach(0, &_module.chip, &_module.rdr, 1);
+    WriteRegister(&_module.rdr, MODE_REG, 0x3D); // CRC preset 0x6363, as CardInit leaves it
+    _module.seed = 1;
+
+    for(; i < sizeof(vectors) / sizeof(vectors[0]); ++i) {
+        dat[0] = vectors[i].dat[0];
+        dat[1] = vectors[i].dat[1];
+        if(Check("vector", dat, 2, vectors[i].crc[0] | (vectors[i].crc[1] << 8)) < 0) return 1;
+    }
+    for(i = 0; i < RANDOM_FRAMES; ++i) {
+        len = 1 + NextByte() % MAX_LEN;
+        for(n = 0; n < len; ++n) dat[n] = NextByte();
+        if(Check("random frame", dat, len, BitwiseCrcA(dat, len)) < 0) return 1;
+    }
+    printf("%s backend: %u vectors and %u random frames OK\n",
+            CRC_A_BACKEND == CRC_A_COPROCESSOR ? "coprocessor" : "software",
+            (unsigned int)(sizeof(vectors) / sizeof(vectors[0])), RANDOM_FRAMES);
+
+#if CRC_A_BACKEND == CRC_A_COPROCESSOR
+    if(CheckTimeout() < 0) return 1;
+    printf("lost IRQ times out without a result\n");
+    Cost();
+#endif
+    return 0;
+}
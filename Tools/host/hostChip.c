@@ -0,0 +1,664 @@
+/*
+ * File:   hostChip.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:55 PM
+ *
+ * The simulated dsPIC behind Tools/host/xc.h. The firmware drivers are
+ * compiled unchanged and run on top of it, with devices attached to SPI1
+ * answering every byte they clock. Chip select, and an I2C operation the
+ * driver gave up on, are seen through the bus capture hooks, so tools build
+ * with -DBUS_CAPTURE=1.
+ *
+ * Only waiting moves the clock: a blocking SPI byte costs its wire time plus
+ * BYTE_OVERHEAD, a DMA transfer its wire time plus the start and finish
+ * overheads, and Idle() skips to the next event. Those overheads are
+ * estimates of the driver code around each byte, not measurements. On I2C1
+ * a start, stop or acknowledge takes one bit time at I2C1BRG and a byte
+ * nine, and the master interrupt comes at the end of each. UART1 sends a
+ * byte every ten bit times at U1BRG, DMA2 keeping its FIFO topped up, and
+ * what goes out is handed to whatever is attached to the line.
+ */
+
+
+#include "hostChip.h"
+#include "../../Common/busCapture.h"
+
+#if !BUS_CAPTURE
+#error "Chip select is seen through the capture hooks, build with -DBUS_CAPTURE=1"
+#endif
+
+#define MAX_EVENTS 32
+#define MAX_DEVICES 8
+#define MAX_DMA_BUFFERS 8
+#define DMA_WINDOW 0x400  // Offsets each buffer gets, so STA can point into the middle of one
+
+#define BYTE_OVERHEAD 12  // Cycles around one SendSPIByte/ReadSPIByte pair
+#define DMA_START 40      // SPITransfer, copying into DMA RAM not included
+#define DMA_FINISH 60     // DMA1 interrupt entry, EndTransaction and the callback
+#define DMA_COPY 4        // Per byte, each way
+
+#define DMA_REQ_U1TX 0x0C
+#define UART_FIFO 5       // Four deep FIFO and the shift register, how far DMA2 gets ahead of the line
+
+#define SPI_LATCHED 0x8000 // SPI1BUF holds what came back, not a byte to send
+#define I2C_EMPTY 0x8000   // Nothing written to I2C1TRN since the last byte went out
+
+/* Firmware interrupt handlers, whichever ones the tool links in */
+void __attribute__((weak)) _T1Interrupt(void);
+void __attribute__((weak)) _DMA1Interrupt(void);
+void __attribute__((weak)) _DMA2Interrupt(void);
+void __attribute__((weak)) _CNInterrupt(void);
+void __attribute__((weak)) _MI2C1Interrupt(void);
+
+#define SFR(name) volatile unsigned int name; volatile hostBits_t name##bits
+
+SFR(AD1PCFGL);
+SFR(TRISA); SFR(TRISB);
+SFR(PORTA); SFR(PORTB);
+SFR(LATA); SFR(LATB);
+SFR(ODCB);
+SFR(CNEN1); SFR(CNEN2);
+SFR(RPINR18); SFR(RPINR20);
+SFR(RPOR3); SFR(RPOR6); SFR(RPOR7);
+SFR(IFS0); SFR(IFS1); SFR(IFS4);
+SFR(IEC0); SFR(IEC1); SFR(IEC4);
+SFR(T1CON); SFR(T2CON); SFR(T3CON);
+SFR(SPI1CON1); SFR(SPI1CON2);
+SFR(DMA0CON); SFR(DMA1CON); SFR(DMA2CON);
+SFR(DMA1REQ);
+SFR(U1MODE); SFR(U1STA);
+
+volatile unsigned int SPI1STAT;
+volatile unsigned int DMA0REQ, DMA2REQ;
+volatile unsigned int DMA0STA, DMA0PAD, DMA0CNT;
+volatile unsigned int DMA1STA, DMA1PAD, DMA1CNT;
+volatile unsigned int DMA2STA, DMA2PAD, DMA2CNT;
+volatile unsigned int PR1, PR2, PR3, TMR2, TMR3, TMR3HLD;
+volatile unsigned int I2C1CON, I2C1STAT, I2C1BRG, I2C1ADD, I2C1MSK;
+volatile unsigned int U1BRG, U1TXREG;
+
+typedef struct {
+    uint64_t when;
+    unsigned long seq; // Same time goes in the order they were queued
+    void (*fn)(void *ctx);
+    void *ctx;
+} event_t;
+
+typedef struct {
+    uint8_t addr;
+    hostSpiDevice_t dev;
+} attached_t;
+
+typedef struct {
+    uint8_t addr;
+    hostI2cDevice_t dev;
+} attachedI2c_t;
+
+static const uint8_t primaryScale[] = { 64, 16, 4, 1 }; // Indexed by PPRE
+
+static struct {
+    unsigned long fcy;
+    uint64_t now;
+
+    unsigned timerOn : 1;
+    uint64_t tickNext; // Next Timer1 period match
+
+    event_t events[MAX_EVENTS];
+    unsigned long seq;
+
+    void *dmaBuffers[MAX_DMA_BUFFERS];
+    unsigned int dmaCnt;
+
+    attached_t devices[MAX_DEVICES];
+    unsigned int deviceCnt;
+    attached_t *selected;
+
+    volatile unsigned int spiBuf;
+    volatile hostBits_t spiStat;
+    volatile hostBits_t dmaReq;
+    volatile unsigned int tmr1;
+
+    attachedI2c_t i2cDevices[MAX_DEVICES];
+    unsigned int i2cDeviceCnt;
+    attachedI2c_t *i2cSelected;
+    volatile hostBits_t i2cCon;
+    volatile hostBits_t i2cStat;
+    volatile unsigned int i2cTrn;
+    volatile unsigned int i2cRcv;
+    unsigned i2cBusy : 1;    // Something on the bus, the master interrupt ends it
+    unsigned i2cAddress : 1; // Next byte out is the address after a start
+
+    volatile hostBits_t uartReq;
+    uint8_t *uartSrc;        // Next byte DMA2 moves
+    unsigned int uartLeft;   // Bytes DMA2 still has to move
+    uint8_t uartFifo[UART_FIFO];
+    unsigned int uartFirst;  // The byte on the wire
+    unsigned int uartQueued;
+    uint64_t uartLineFree;   // When the last byte queued is all the way out
+    void (*uartRx)(void *ctx, uint8_t b);
+    void *uartCtx;
+
+    int inInterrupt;
+    unsigned cnPending : 1;
+
+    hostBusStats_t bus;
+    hostBusStats_t i2c;
+    hostBusStats_t uart;
+} _module;
+
+void HostInit(unsigned long fcy)
+{
+    _module.fcy = fcy;
+    _module.spiBuf = SPI_LATCHED;
+    _module.i2cTrn = I2C_EMPTY;
+}
+
+unsigned long HostFcy()
+{
+    return _module.fcy;
+}
+
+uint64_t HostNow()
+{
+    return _module.now;
+}
+
+double HostUs(uint64_t cycles)
+{
+    return cycles * 1000000.0 / _module.fcy;
+}
+
+/****** Interrupts *******/
+
+static void Interrupt(void (*isr)(void), unsigned int enabled)
+{
+    if(!isr || !enabled) return;
+    _module.inInterrupt++;
+    (*isr)();
+    _module.inInterrupt--;
+    /* A pin that changed inside a handler is taken right after it */
+    if(!_module.inInterrupt && _module.cnPending) {
+        _module.cnPending = 0;
+        Interrupt(_CNInterrupt, IEC1bits.CNIE);
+    }
+}
+
+void HostSetPin(volatile unsigned int *port, unsigned int mask, int level,
+        volatile unsigned int *cnEnable, unsigned int cnMask)
+{
+    unsigned int old = *port & mask;
+
+    if(level) *port |= mask;
+    else *port &= ~mask;
+    if(old == (*port & mask) || !(*cnEnable & cnMask)) return;
+    IFS1bits.CNIF = 1;
+    if(_module.inInterrupt) _module.cnPending = 1;
+    else Interrupt(_CNInterrupt, IEC1bits.CNIE);
+}
+
+/****** Clock *******/
+
+static void CommitI2c();
+
+/* Timer1 starts counting from 0 when the firmware sets TON */
+static void SyncTimer()
+{
+    if(_module.timerOn || !T1CONbits.TON) return;
+    _module.timerOn = 1;
+    _module.tickNext = _module.now + PR1 + 1;
+}
+
+/* Earliest queued event, -1 if there is none */
+static int NextEvent()
+{
+    int best = -1;
+    int i = 0;
+
+    for(; i < MAX_EVENTS; ++i) {
+        event_t *e = &_module.events[i];
+        if(!e->fn) continue;
+        if(best < 0 || e->when < _module.events[best].when ||
+                (e->when == _module.events[best].when && e->seq < _module.events[best].seq)) best = i;
+    }
+    return best;
+}
+
+void HostRunUntil(uint64_t when)
+{
+    int e;
+
+    /* Handlers run in the middle of whatever they interrupted, they can't wait */
+    if(_module.inInterrupt) return;
+    CommitI2c();
+    SyncTimer();
+    for(;;) {
+        e = NextEvent();
+        if(_module.timerOn && _module.tickNext <= when &&
+                (e < 0 || _module.tickNext <= _module.events[e].when)) {
+            _module.now = _module.tickNext;
+            _module.tickNext += PR1 + 1;
+            IFS0bits.T1IF = 1;
+            Interrupt(_T1Interrupt, IEC0bits.T1IE);
+            continue;
+        }
+        if(e < 0 || _module.events[e].when > when) break;
+        {
+            event_t ev = _module.events[e];
+            _module.events[e].fn = 0;
+            if(ev.when > _module.now) _module.now = ev.when;
+            (*ev.fn)(ev.ctx);
+        }
+    }
+    if(when > _module.now) _module.now = when;
+}
+
+void HostAdvance(uint64_t cycles)
+{
+    HostRunUntil(_module.now + cycles);
+}
+
+int HostAt(uint64_t when, void (*fn)(void *ctx), void *ctx)
+{
+    int i = 0;
+
+    for(; i < MAX_EVENTS; ++i) {
+        event_t *e = &_module.events[i];
+        if(e->fn) continue;
+        e->when = when;
+        e->seq = _module.seq++;
+        e->fn = fn;
+        e->ctx = ctx;
+        return i;
+    }
+    return -1;
+}
+
+void HostCancel(int event)
+{
+    if(event < 0 || event >= MAX_EVENTS) return;
+    _module.events[event].fn = 0;
+}
+
+/* Core sleeps until the next thing that could interrupt it */
+void HostIdle()
+{
+    int e;
+    uint64_t when;
+
+    CommitI2c();
+    e = NextEvent();
+    SyncTimer();
+    if(_module.timerOn) when = _module.tickNext;
+    else if(e >= 0) when = _module.events[e].when;
+    else return;
+    if(e >= 0 && _module.events[e].when < when) when = _module.events[e].when;
+    HostRunUntil(when);
+}
+
+volatile unsigned int *HostTimer()
+{
+    SyncTimer();
+    _module.tmr1 = _module.timerOn ? (unsigned int)(_module.now - (_module.tickNext - PR1 - 1)) : 0;
+    return &_module.tmr1;
+}
+
+/****** SPI1 *******/
+
+void HostSpiAttach(uint8_t addr, const hostSpiDevice_t *dev)
+{
+    if(_module.deviceCnt >= MAX_DEVICES) return;
+    _module.devices[_module.deviceCnt].addr = addr;
+    _module.devices[_module.deviceCnt].dev = *dev;
+    _module.deviceCnt++;
+}
+
+void GetHostBusStats(hostBusStats_t *stats)
+{
+    *stats = _module.bus;
+}
+
+static unsigned int ByteCycles()
+{
+    unsigned int ppre = SPI1CON1 & 0x03;
+    unsigned int secondary = 8 - ((SPI1CON1 >> 2) & 0x07);
+    return 8 * primaryScale[ppre] * secondary;
+}
+
+static uint8_t Exchange(uint8_t tx)
+{
+    attached_t *a = _module.selected;
+
+    _module.bus.bytes++;
+    if(!a) return 0xFF; // Nothing driving MISO
+    return (*a->dev.exchange)(a->dev.ctx, tx);
+}
+
+/* A byte written to SPI1BUF goes out the next time the firmware looks at SPI1 */
+static void CommitSpi()
+{
+    unsigned int cycles;
+    uint8_t tx;
+
+    if(_module.spiBuf & SPI_LATCHED) return;
+    tx = _module.spiBuf;
+    cycles = ByteCycles();
+    _module.bus.busy += cycles;
+    HostAdvance(cycles + BYTE_OVERHEAD);
+    _module.spiBuf = SPI_LATCHED | Exchange(tx);
+    _module.spiStat.SPIRBF = 1;
+}
+
+volatile unsigned int *HostSpiBuf()
+{
+    CommitSpi();
+    return &_module.spiBuf;
+}
+
+volatile hostBits_t *HostSpiStat()
+{
+    CommitSpi();
+    _module.spiStat.SPITBF = 0;
+    return &_module.spiStat;
+}
+
+unsigned int HostDmaOffset(void *buf)
+{
+    unsigned int i = 0;
+
+    for(; i < _module.dmaCnt; ++i) {
+        if(_module.dmaBuffers[i] == buf) return i * DMA_WINDOW;
+    }
+    if(_module.dmaCnt < MAX_DMA_BUFFERS) _module.dmaBuffers[_module.dmaCnt++] = buf;
+    return i * DMA_WINDOW;
+}
+
+/* Back from an offset to the buffer, 0 if it isn't in one HostDmaOffset handed out */
+static uint8_t *DmaAddress(unsigned int offset)
+{
+    unsigned int i = offset / DMA_WINDOW;
+
+    if(i >= _module.dmaCnt) return 0;
+    return (uint8_t *) _module.dmaBuffers[i] + offset % DMA_WINDOW;
+}
+
+/*
+ * spiDriver only touches DMA0REQbits to FORCE the first byte, so this runs
+ * the whole transfer through to the DMA1 interrupt before SPITransfer
+ * returns. Interrupts that come due on the way still go first.
+ */
+volatile hostBits_t *HostDmaForce()
+{
+    unsigned int cnt = DMA0CNT + 1;
+    uint8_t *tx = DmaAddress(DMA0STA);
+    uint8_t *rx = DmaAddress(DMA1STA);
+    unsigned int cycles = cnt * ByteCycles();
+    unsigned int i = 0;
+
+    if(!DMA0CONbits.CHEN || !DMA1CONbits.CHEN || !tx || !rx) {
+        return &_module.dmaReq;
+    }
+    _module.bus.transfers++;
+    _module.bus.busy += cycles;
+    HostAdvance(DMA_START + cycles);
+    for(; i < cnt; ++i) {
+        rx[i] = Exchange(tx[i]);
+    }
+    DMA0CONbits.CHEN = 0;
+    DMA1CONbits.CHEN = 0;
+    IFS0bits.DMA1IF = 1;
+    Interrupt(_DMA1Interrupt, IEC0bits.DMA1IE);
+    HostAdvance(DMA_FINISH + 2 * DMA_COPY * cnt);
+    return &_module.dmaReq;
+}
+
+/****** UART1 *******/
+
+void HostUartAttach(void (*rx)(void *ctx, uint8_t b), void *ctx)
+{
+    _module.uartRx = rx;
+    _module.uartCtx = ctx;
+}
+
+void GetHostUartStats(hostBusStats_t *stats)
+{
+    *stats = _module.uart;
+}
+
+/* Start bit, eight data bits and the stop bits */
+static unsigned int FrameCycles()
+{
+    unsigned int bitCycles = (U1MODEbits.BRGH ? 4 : 16) * (U1BRG + 1);
+    return (10 + U1MODEbits.STSEL) * bitCycles;
+}
+
+static void UartShifted(void *ctx);
+
+/* DMA2 moves bytes in for as long as the FIFO has room, and interrupts once it has moved them all */
+static void UartFeed(void *ctx)
+{
+    unsigned int cycles;
+
+    if(!_module.uartLeft) return;
+    while(_module.uartLeft && _module.uartQueued < UART_FIFO) {
+        _module.uartFifo[(_module.uartFirst + _module.uartQueued) % UART_FIFO] = *_module.uartSrc++;
+        _module.uartQueued++;
+        _module.uartLeft--;
+        cycles = FrameCycles();
+        if(_module.uartLineFree < _module.now) _module.uartLineFree = _module.now;
+        _module.uartLineFree += cycles;
+        _module.uart.bytes++;
+        _module.uart.busy += cycles;
+        HostAt(_module.uartLineFree, UartShifted, 0);
+    }
+    if(_module.uartLeft) return;
+    DMA2CONbits.CHEN = 0;
+    IFS1bits.DMA2IF = 1;
+    Interrupt(_DMA2Interrupt, IEC1bits.DMA2IE);
+}
+
+/* A byte's stop bit is out, which makes room for the next */
+static void UartShifted(void *ctx)
+{
+    uint8_t b = _module.uartFifo[_module.uartFirst];
+
+    _module.uartFirst = (_module.uartFirst + 1) % UART_FIFO;
+    _module.uartQueued--;
+    if(_module.uartRx) (*_module.uartRx)(_module.uartCtx, b);
+    UartFeed(0);
+}
+
+/*
+ * uartDriver FORCEs the first byte of each chunk, the UART asks for the rest
+ * as its FIFO drains. Bytes go from the buffer when DMA2 moves them, so the
+ * firmware can't change what's already on its way.
+ */
+volatile hostBits_t *HostUartForce()
+{
+    uint8_t *src = DmaAddress(DMA2STA);
+
+    if(!DMA2CONbits.CHEN || DMA2REQ != DMA_REQ_U1TX || !U1MODEbits.UARTEN || !U1STAbits.UTXEN || !src) {
+        return &_module.uartReq;
+    }
+    _module.uart.transfers++;
+    _module.uartSrc = src;
+    _module.uartLeft = DMA2CNT + 1;
+    HostAt(_module.now, UartFeed, 0);
+    return &_module.uartReq;
+}
+
+/****** I2C1 *******/
+
+void HostI2cAttach(uint8_t addr, const hostI2cDevice_t *dev)
+{
+    if(_module.i2cDeviceCnt >= MAX_DEVICES) return;
+    _module.i2cDevices[_module.i2cDeviceCnt].addr = addr;
+    _module.i2cDevices[_module.i2cDeviceCnt].dev = *dev;
+    _module.i2cDeviceCnt++;
+}
+
+void GetHostI2cStats(hostBusStats_t *stats)
+{
+    *stats = _module.i2c;
+}
+
+static unsigned int I2cBitCycles()
+{
+    /* I2C1BRG = Fcy / Fscl - Fcy / 10 MHz - 1 */
+    return I2C1BRG + 1 + _module.fcy / 10000000;
+}
+
+static void I2cDone(void *ctx)
+{
+    _module.i2cBusy = 0;
+    _module.i2cCon.SEN = 0;
+    _module.i2cCon.PEN = 0;
+    _module.i2cCon.RCEN = 0;
+    _module.i2cCon.ACKEN = 0;
+    _module.i2cStat.TRSTAT = 0;
+    _module.i2cStat.TBF = 0;
+    IFS1bits.MI2C1IF = 1;
+    Interrupt(_MI2C1Interrupt, IEC1bits.MI2C1IE);
+}
+
+static void I2cAfter(unsigned int bits)
+{
+    unsigned int cycles = bits * I2cBitCycles();
+
+    _module.i2cBusy = 1;
+    _module.i2c.busy += cycles;
+    HostAt(_module.now + cycles, I2cDone, 0);
+}
+
+/* Byte out of I2C1TRN, the address when it follows a start */
+static int I2cWrite(uint8_t b)
+{
+    attachedI2c_t *a = _module.i2cSelected;
+    unsigned int i = 0;
+
+    _module.i2c.bytes++;
+    if(!_module.i2cAddress) return a && (*a->dev.write)(a->dev.ctx, b);
+    _module.i2cAddress = 0;
+    _module.i2cSelected = 0;
+    for(; i < _module.i2cDeviceCnt; ++i) {
+        if(_module.i2cDevices[i].addr != (b >> 1)) continue;
+        _module.i2cSelected = &_module.i2cDevices[i];
+        return (*_module.i2cSelected->dev.start)(_module.i2cSelected->dev.ctx, b & 0x01);
+    }
+    return 0; // Nobody there to ACK
+}
+
+/* Whatever the firmware asked of the master since it last looked, one thing at a time like the module */
+static void CommitI2c()
+{
+    attachedI2c_t *a = _module.i2cSelected;
+
+    if(_module.i2cBusy) return;
+    if(_module.i2cCon.SEN) {
+        _module.i2c.windows++;
+        _module.i2c.opened = _module.now;
+        _module.i2cAddress = 1;
+        I2cAfter(1);
+    } else if(_module.i2cCon.PEN) {
+        _module.i2cSelected = 0;
+        if(a) (*a->dev.stop)(a->dev.ctx);
+        I2cAfter(1);
+    } else if(_module.i2cCon.RCEN) {
+        _module.i2c.bytes++;
+        _module.i2cRcv = a ? (*a->dev.read)(a->dev.ctx) : 0xFF;
+        _module.i2cStat.RBF = 1;
+        I2cAfter(8);
+    } else if(_module.i2cCon.ACKEN) {
+        I2cAfter(1);
+    } else if(!(_module.i2cTrn & I2C_EMPTY)) {
+        uint8_t b = _module.i2cTrn;
+        _module.i2cTrn = I2C_EMPTY;
+        _module.i2cStat.ACKSTAT = !I2cWrite(b);
+        _module.i2cStat.TRSTAT = 1;
+        _module.i2cStat.TBF = 1;
+        I2cAfter(9);
+    }
+}
+
+volatile hostBits_t *HostI2cCon()
+{
+    CommitI2c();
+    return &_module.i2cCon;
+}
+
+volatile hostBits_t *HostI2cStat()
+{
+    CommitI2c();
+    return &_module.i2cStat;
+}
+
+volatile unsigned int *HostI2cTrn()
+{
+    CommitI2c();
+    return &_module.i2cTrn;
+}
+
+volatile unsigned int *HostI2cRcv()
+{
+    CommitI2c();
+    _module.i2cStat.RBF = 0;
+    return &_module.i2cRcv;
+}
+
+/****** Capture hooks, which is where chip select and failed I2C operations are seen *******/
+
+void CaptureStart(uint8_t bus, uint8_t addr)
+{
+    unsigned int i = 0;
+
+    if(bus != BUS_SPI) return;
+    _module.bus.windows++;
+    _module.bus.opened = _module.now;
+    _module.selected = 0;
+    for(; i < _module.deviceCnt; ++i) {
+        if(_module.devices[i].addr != addr) continue;
+        _module.selected = &_module.devices[i];
+        (*_module.selected->dev.select)(_module.selected->dev.ctx);
+        break;
+    }
+}
+
+void CaptureByte(uint8_t bus, uint8_t b)
+{
+}
+
+void CapturePair(uint8_t bus, uint8_t tx)
+{
+}
+
+void CaptureReply(uint8_t bus, uint8_t rx)
+{
+}
+
+void CaptureEnd(uint8_t bus, uint8_t flags)
+{
+    attached_t *a = _module.selected;
+    attachedI2c_t *i2c = _module.i2cSelected;
+
+    if(bus == BUS_I2C) {
+        /* The bus is left after the NACK with no stop, so the device can't tell on its own */
+        if(!(flags & CAPTURE_FAILED)) return;
+        _module.i2cSelected = 0;
+        if(i2c && i2c->dev.abandon) (*i2c->dev.abandon)(i2c->dev.ctx);
+        return;
+    }
+    CommitSpi();
+    _module.selected = 0;
+    if(a) (*a->dev.deselect)(a->dev.ctx);
+}
+
+/* Nothing is recorded on the host, these only watch chip select */
+unsigned int CaptureRead(uint8_t *out, unsigned int max)
+{
+    return 0;
+}
+
+unsigned long CaptureDropped()
+{
+    return 0;
+}
@@ -0,0 +1,75 @@
+#ifndef __HOST_CHIP_H_
+#define	__HOST_CHIP_H_
+
+#include "xc.h"
+
+/*
+ * Simulated dsPIC around the firmware drivers: an instruction cycle clock,
+ * Timer1, SPI1 with its two DMA channels, the I2C1 master, UART1 sending
+ * through DMA2, and the pins devices drive. Time only moves when the
+ * firmware waits on a bus or goes into Idle, so code between bus accesses
+ * is treated as free.
+ */
+
+/* A device on SPI1, picked by the same chip-select address bus captures use */
+typedef struct {
+    void (*select)(void *ctx);
+    uint8_t (*exchange)(void *ctx, uint8_t tx); // Returns what the device clocks back
+    void (*deselect)(void *ctx);
+    void *ctx;
+} hostSpiDevice_t;
+
+/* A device on I2C1, picked by its 7-bit address */
+typedef struct {
+    int (*start)(void *ctx, int read); // Addressed after a start, returns 1 to ACK
+    int (*write)(void *ctx, uint8_t b); // Returns 1 to ACK
+    uint8_t (*read)(void *ctx);
+    void (*stop)(void *ctx);
+    void (*abandon)(void *ctx); // Master gave up on a NACK without a stop, may be 0
+    void *ctx;
+} hostI2cDevice_t;
+
+typedef struct {
+    unsigned long bytes;     // Clocked on the bus, I2C address bytes included
+    unsigned long windows;   // Chip-select windows, or I2C starts
+    unsigned long transfers; // SPI windows that went over DMA, or DMA2 chunks on the UART
+    uint64_t busy;           // Cycles the clock line was running
+    uint64_t opened;         // When the last window opened
+} hostBusStats_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    void HostInit(unsigned long fcy);
+    unsigned long HostFcy();
+    uint64_t HostNow();
+    double HostUs(uint64_t cycles);
+
+    /* Moves the clock on, running every event and interrupt that comes due on the way */
+    void HostAdvance(uint64_t cycles);
+    void HostRunUntil(uint64_t when);
+
+    /* One-shot event, returns an id for HostCancel or -1 when the queue is full */
+    int HostAt(uint64_t when, void (*fn)(void *ctx), void *ctx);
+    void HostCancel(int event);
+
+    void HostSpiAttach(uint8_t addr, const hostSpiDevice_t *dev);
+    void GetHostBusStats(hostBusStats_t *stats);
+
+    void HostI2cAttach(uint8_t addr, const hostI2cDevice_t *dev);
+    void GetHostI2cStats(hostBusStats_t *stats);
+
+    /* Gets every byte UART1 sends, as its stop bit finishes */
+    void HostUartAttach(void (*rx)(void *ctx, uint8_t b), void *ctx);
+    void GetHostUartStats(hostBusStats_t *stats);
+
+    /* Drives an input pin, and raises the CN interrupt if its CN bit is enabled */
+    void HostSetPin(volatile unsigned int *port, unsigned int mask, int level,
+            volatile unsigned int *cnEnable, unsigned int cnMask);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* __HOST_CHIP_H_ */
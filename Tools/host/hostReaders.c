@@ -0,0 +1,40 @@
+/*
+ * File:   hostReaders.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 2:10 PM
+ *
+ * The readers of RFID-Reader.X/main.c for the host tools, each an MFRC522
+ * model on the same pins, so every tool brings them up the same way.
+ */
+
+
+#include "hostReaders.h"
+#include "../../RFID-Reader.X/global.h"
+#include "../../RFID-Reader.X/spiDriver.h"
+#include "../../Common/scheduler.h"
+
+/* Same wiring as RFID-Reader.X/main.c */
+static const readerPins_t readerPins[MAX_READERS] = {
+    { &TRISB, &LATB, 1 << 12, &TRISB, &PORTB, 1 << 11, &CNEN1, 1 << 15 },
+    { &TRISB, &LATB, 1 << 10, &TRISB, &PORTB, 1 << 4,  &CNEN1, 1 << 1 },
+    { &TRISB, &LATB, 1 << 2,  &TRISB, &PORTB, 1 << 3,  &CNEN1, 1 << 7 },
+    { &TRISA, &LATA, 1 << 2,  &TRISA, &PORTA, 1 << 4,  &CNEN1, 1 << 0 },
+};
+/* Chip-select address spiDriver captures each one under, the bit number with 0x80 for port A */
+static const uint8_t csAddrs[MAX_READERS] = { 12, 10, 2, 0x82 };
+
+void HostReadersInit()
+{
+    HostInit(CLOCK_RATE);
+    InitScheduler(CLOCK_RATE);
+    InitializeSPIDriver();
+}
+
+void HostReaderAttach(unsigned int i, mfrc522Model_t *m, mfrc522_t *rdr, uint32_t seed)
+{
+    const readerPins_t *pins = &readerPins[i];
+
+    ModelInit(m, csAddrs[i], pins->irqPort, pins->irqMask, pins->cnEnable, pins->cnMask, seed);
+    InitReader(rdr, pins);
+}
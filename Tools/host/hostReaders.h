@@ -0,0 +1,26 @@
+#ifndef __HOST_READERS_H_
+#define	__HOST_READERS_H_
+
+#include "hostChip.h"
+#include "mfrc522Model.h"
+#include "../../RFID-Reader.X/mfrc522.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /* Fresh host clock at CLOCK_RATE, with the scheduler and the SPI driver started on it */
+    void HostReadersInit();
+
+    /*
+     * Puts a model of reader i (up to MAX_READERS) on the wiring it has in
+     * RFID-Reader.X/main.c and brings up the driver for it. seed is the
+     * model's, for its tag UIDs and random numbers.
+     */
+    void HostReaderAttach(unsigned int i, mfrc522Model_t *m, mfrc522_t *rdr, uint32_t seed);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* __HOST_READERS_H_ */
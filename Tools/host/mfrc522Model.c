@@ -0,0 +1,745 @@
+/*
+ * File:   mfrc522Model.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:55 PM
+ *
+ * MFRC522 and a field of ISO 14443A tags, attached to the simulated SPI1
+ * in hostChip.c. Behaviour follows the datasheet for the parts the driver
+ * uses. Mem and GenerateRandomID times aren't in the datasheet, so the ones
+ * below are guesses; CalcCRC is treated as done by the end of the byte that
+ * starts it.
+ */
+
+
+#include <string.h>
+#include "mfrc522Model.h"
+
+// Registers
+#define REG_COMMAND      0x01
+#define REG_COM_IEN      0x02
+#define REG_DIV_IEN      0x03
+#define REG_COM_IRQ      0x04
+#define REG_DIV_IRQ      0x05
+#define REG_ERROR        0x06
+#define REG_STATUS1      0x07
+#define REG_STATUS2      0x08
+#define REG_FIFO_DATA    0x09
+#define REG_FIFO_LEVEL   0x0A
+#define REG_WATER_LEVEL  0x0B
+#define REG_CONTROL      0x0C
+#define REG_BIT_FRAMING  0x0D
+#define REG_COLL         0x0E
+#define REG_MODE         0x11
+#define REG_TX_CONTROL   0x14
+#define REG_CRC_RESULT_H 0x21
+#define REG_CRC_RESULT_L 0x22
+#define REG_T_MODE       0x2A
+#define REG_T_PRESCALER  0x2B
+#define REG_T_RELOAD_H   0x2C
+#define REG_T_RELOAD_L   0x2D
+#define REG_T_COUNTER_H  0x2E
+#define REG_T_COUNTER_L  0x2F
+#define REG_VERSION      0x37
+
+// Commands
+#define CMD_IDLE            0x00
+#define CMD_MEM             0x01
+#define CMD_GENERATE_RANDOM 0x02
+#define CMD_CALC_CRC        0x03
+#define CMD_TRANSMIT        0x04
+#define CMD_RECEIVE         0x08
+#define CMD_TRANSCEIVE      0x0C
+#define CMD_SOFT_RESET      0x0F
+
+// ComIrqReg, DivIrqReg, ErrorReg and Status1Reg bits
+#define IRQ_INV      0x80
+#define TX_IRQ       0x40
+#define RX_IRQ       0x20
+#define IDLE_IRQ     0x10
+#define TIMER_IRQ    0x01
+#define CRC_IRQ      0x04
+#define COLL_ERR     0x08
+#define BUFFER_OVFL  0x10
+#define STATUS_IRQ   0x10
+#define STATUS_TRUNNING 0x08
+#define STATUS_CRC_READY 0x20
+
+// PICC commands
+#define PICC_REQA 0x26
+#define PICC_WUPA 0x52
+#define PICC_SEL_CL1 0x93
+#define PICC_HLTA 0x50
+#define PICC_CT   0x88
+
+#define CARRIER 13560000.0
+#define BIT_CARRIER 128   // One bit at 106 kbit/s
+#define FDT_CARRIER 1172  // End of the reader's frame to the tag's answer
+#define MEM_US 5
+#define RANDOM_US 50
+
+static const uint16_t crcPresets[] = { 0x0000, 0x6363, 0xA671, 0xFFFF }; // Indexed by ModeReg CRCPreset
+
+static uint64_t Carrier(mfrc522Model_t *m, double clocks)
+{
+    return (uint64_t)(clocks * HostFcy() / CARRIER + 0.5);
+}
+
+static uint64_t Microseconds(unsigned long us)
+{
+    return (uint64_t) us * HostFcy() / 1000000;
+}
+
+/* Air time of a frame, with SOF, a parity bit per whole byte and EOF */
+static uint64_t FrameCycles(mfrc522Model_t *m, unsigned int bits)
+{
+    return Carrier(m, (double) BIT_CARRIER * (bits + bits / 8 + 2));
+}
+
+uint32_t ModelRandom(mfrc522Model_t *m)
+{
+    /* xorshift32, reproducible from the seed */
+    m->seed ^= m->seed << 13;
+    m->seed ^= m->seed >> 17;
+    m->seed ^= m->seed << 5;
+    return m->seed;
+}
+
+static uint16_t Crc(uint16_t crc, const uint8_t *dat, unsigned int len)
+{
+    unsigned int i;
+
+    for(; len > 0; --len) {
+        crc ^= *dat++;
+        for(i = 0; i < 8; ++i) {
+            crc = (crc & 0x0001) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+uint16_t ModelCrcA(const uint8_t *dat, unsigned int len)
+{
+    return Crc(0x6363, dat, len);
+}
+
+static int Bit(const uint8_t *dat, unsigned int i)
+{
+    return (dat[i / 8] >> (i % 8)) & 0x01;
+}
+
+static void PutBit(uint8_t *dat, unsigned int i, int b)
+{
+    if(b) dat[i / 8] |= 1 << (i % 8);
+    else dat[i / 8] &= ~(1 << (i % 8));
+}
+
+/****** Registers *******/
+
+/* Every change the chip makes by itself goes through here */
+static void SetReg(mfrc522Model_t *m, uint8_t reg, uint8_t val)
+{
+    if(m->regs[reg] != val) m->changed[reg >> 4] |= 1 << (reg & 0x0F);
+    m->regs[reg] = val;
+}
+
+static void UpdateStatus(mfrc522Model_t *m)
+{
+    uint8_t st = m->regs[REG_STATUS1] & STATUS_CRC_READY;
+    uint8_t water = m->regs[REG_WATER_LEVEL];
+
+    if((m->regs[REG_COM_IEN] & m->regs[REG_COM_IRQ] & 0x7F) || (m->regs[REG_DIV_IEN] & m->regs[REG_DIV_IRQ] & 0x14)) {
+        st |= STATUS_IRQ;
+    }
+    if(m->timerEvent >= 0) st |= STATUS_TRUNNING;
+    if(m->fifoLen <= water) st |= 0x01;                   // LoAlert
+    if(MODEL_FIFO_SIZE - m->fifoLen <= water) st |= 0x02; // HiAlert
+    SetReg(m, REG_STATUS1, st);
+    SetReg(m, REG_FIFO_LEVEL, m->fifoLen);
+}
+
+/* Pin follows IRq, inverted when IRqInv is set */
+static void UpdateIrq(mfrc522Model_t *m)
+{
+    int level;
+
+    UpdateStatus(m);
+    level = (m->regs[REG_STATUS1] & STATUS_IRQ) != 0;
+    if(m->regs[REG_COM_IEN] & IRQ_INV) level = !level;
+    HostSetPin(m->irqPort, m->irqMask, level, m->cnEnable, m->cnMask);
+}
+
+static void RaiseIrq(mfrc522Model_t *m, uint8_t com, uint8_t div)
+{
+    SetReg(m, REG_COM_IRQ, m->regs[REG_COM_IRQ] | com);
+    SetReg(m, REG_DIV_IRQ, m->regs[REG_DIV_IRQ] | div);
+    UpdateIrq(m);
+}
+
+static void Push(mfrc522Model_t *m, uint8_t b)
+{
+    if(m->fifoLen >= MODEL_FIFO_SIZE) {
+        SetReg(m, REG_ERROR, m->regs[REG_ERROR] | BUFFER_OVFL);
+        return;
+    }
+    m->fifo[m->fifoLen++] = b;
+}
+
+static uint8_t Pop(mfrc522Model_t *m)
+{
+    uint8_t b;
+
+    if(m->fifoLen == 0) return 0;
+    b = m->fifo[0];
+    memmove(m->fifo, m->fifo + 1, --m->fifoLen);
+    return b;
+}
+
+static void Flush(mfrc522Model_t *m)
+{
+    m->fifoLen = 0;
+    SetReg(m, REG_ERROR, m->regs[REG_ERROR] & ~BUFFER_OVFL);
+}
+
+static void ResetRegisters(mfrc522Model_t *m)
+{
+    memset(m->regs, 0, sizeof(m->regs));
+    m->regs[REG_COMMAND] = 0x20;
+    m->regs[REG_COM_IEN] = 0x80;
+    m->regs[REG_COM_IRQ] = 0x14;
+    m->regs[REG_STATUS1] = 0x21;
+    m->regs[REG_WATER_LEVEL] = 0x08;
+    m->regs[REG_CONTROL] = 0x10;
+    m->regs[REG_COLL] = 0x80;
+    m->regs[REG_MODE] = 0x3F;
+    m->regs[REG_TX_CONTROL] = 0x80;
+    m->regs[0x16] = 0x10; // TxSelReg
+    m->regs[0x17] = 0x84; // RxSelReg
+    m->regs[0x18] = 0x84; // RxThresholdReg
+    m->regs[0x19] = 0x4D; // DemodReg
+    m->regs[REG_CRC_RESULT_H] = 0xFF;
+    m->regs[REG_CRC_RESULT_L] = 0xFF;
+    m->regs[0x24] = 0x26; // ModWidthReg
+    m->regs[0x26] = 0x48; // RFCfgReg
+    m->regs[0x27] = 0x88; // GsNReg
+    m->regs[0x28] = 0x20; // CWGsPReg
+    m->regs[0x29] = 0x20; // ModGsPReg
+    m->regs[REG_VERSION] = 0x92;
+    m->fifoLen = 0;
+}
+
+/****** Timer *******/
+
+static uint64_t TimerTick(mfrc522Model_t *m)
+{
+    unsigned int prescaler = ((m->regs[REG_T_MODE] & 0x0F) << 8) | m->regs[REG_T_PRESCALER];
+    return Carrier(m, 2.0 * prescaler + 1);
+}
+
+static void TimerDone(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+
+    m->timerEvent = -1;
+    RaiseIrq(m, TIMER_IRQ, 0);
+}
+
+static void StartTimer(mfrc522Model_t *m)
+{
+    unsigned int reload = (m->regs[REG_T_RELOAD_H] << 8) | m->regs[REG_T_RELOAD_L];
+
+    HostCancel(m->timerEvent);
+    m->timerStart = HostNow();
+    m->timerEnd = m->timerStart + TimerTick(m) * (reload + 1);
+    m->timerEvent = HostAt(m->timerEnd, TimerDone, m);
+}
+
+static void StopTimer(mfrc522Model_t *m)
+{
+    HostCancel(m->timerEvent);
+    m->timerEvent = -1;
+}
+
+static unsigned int TimerValue(mfrc522Model_t *m)
+{
+    if(m->timerEvent < 0) return 0;
+    return (unsigned int)((m->timerEnd - HostNow()) / TimerTick(m));
+}
+
+/****** Tags *******/
+
+static unsigned int Levels(const modelTag_t *tag)
+{
+    return tag->uidLen == 4 ? 1 : tag->uidLen == 7 ? 2 : 3;
+}
+
+/* UID CLn and BCC for a cascade level */
+static void CascadeLevel(const modelTag_t *tag, unsigned int level, uint8_t *cl)
+{
+    const uint8_t *part = tag->uid + 3 * level;
+    unsigned int i = 0;
+
+    if(level < Levels(tag) - 1) {
+        cl[0] = PICC_CT;
+        for(; i < 3; ++i) cl[1 + i] = part[i];
+    } else {
+        for(; i < 4; ++i) cl[i] = part[i];
+    }
+    cl[4] = cl[0] ^ cl[1] ^ cl[2] ^ cl[3];
+}
+
+static int FrameCrcOk(const uint8_t *f, unsigned int bits)
+{
+    unsigned int len = bits / 8;
+    uint16_t crc;
+
+    if(bits % 8 || len < 3) return 0;
+    crc = ModelCrcA(f, len - 2);
+    return f[len - 2] == (crc & 0xFF) && f[len - 1] == (crc >> 8);
+}
+
+/*
+ * What one tag makes of the frame that just went out. Returns 1 and fills
+ * out when it answers, with offset the UID CLn bit the answer starts at.
+ */
+static int TagReceive(mfrc522Model_t *m, modelTag_t *tag, uint8_t *out, unsigned int *bits, unsigned int *offset)
+{
+    const uint8_t *f = m->frame;
+    unsigned int level;
+    unsigned int known;
+    unsigned int i;
+    uint8_t cl[5];
+
+    *offset = 0;
+    if(m->frameBits == 7) {
+        uint8_t cmd = f[0] & 0x7F;
+        if((cmd == PICC_REQA && tag->st == TagIdle) ||
+                (cmd == PICC_WUPA && (tag->st == TagIdle || tag->st == TagHalt))) {
+            tag->st = TagReady;
+            tag->level = 0;
+            out[0] = 0x04 | ((Levels(tag) - 1) << 6); // ATQA, UID size and bit frame anticollision
+            out[1] = 0x00;
+            *bits = 16;
+            return 1;
+        }
+    } else if(m->frameBits >= 16 && (f[0] & 0xF9) == 0x91 && f[0] >= PICC_SEL_CL1) {
+        level = (f[0] - PICC_SEL_CL1) / 2;
+        if(tag->st != TagReady) return 0;
+        if(level != tag->level) {
+            tag->st = TagIdle;
+            return 0;
+        }
+        CascadeLevel(tag, level, cl);
+        if(f[1] == 0x70) {
+            if(m->frameBits != 72 || !FrameCrcOk(f, 72)) return 0;
+            if(memcmp(&f[2], cl, 5) != 0) {
+                tag->st = TagIdle;
+                return 0;
+            }
+            if(level < Levels(tag) - 1) {
+                out[0] = 0x04; // Cascade bit, UID not complete
+                tag->level++;
+            } else {
+                out[0] = 0x08;
+                tag->st = TagActive;
+            }
+            i = ModelCrcA(out, 1);
+            out[1] = i & 0xFF;
+            out[2] = i >> 8;
+            *bits = 24;
+            return 1;
+        }
+        known = (f[1] >> 4) * 8 + (f[1] & 0x0F);
+        if(known < 16 || known > 16 + 32 || m->frameBits != known) return 0;
+        known -= 16;
+        for(i = 0; i < known; ++i) {
+            if(Bit(f + 2, i) != Bit(cl, i)) return 0;
+        }
+        memset(out, 0, 5);
+        for(i = known; i < 40; ++i) {
+            PutBit(out, i - known, Bit(cl, i));
+        }
+        *bits = 40 - known;
+        *offset = known;
+        return 1;
+    } else if(m->frameBits == 32 && f[0] == PICC_HLTA && f[1] == 0x00 && FrameCrcOk(f, 32)) {
+        if(tag->st == TagActive) {
+            tag->st = TagHalt;
+            if(m->halted) (*m->halted)(m, tag);
+            return 0;
+        }
+    }
+    /* Anything unexpected sends a tag that was taking part back to Idle */
+    if(tag->st == TagReady || tag->st == TagActive) tag->st = TagIdle;
+    return 0;
+}
+
+/* Every tag hears the frame, and whatever they send back lands on top of each other */
+static void Answer(mfrc522Model_t *m)
+{
+    uint8_t out[MODEL_MAX_FRAME];
+    unsigned int bits;
+    unsigned int offset;
+    int first = -1; // Bit of the first collision
+    int any = 0;
+    unsigned int t = 0;
+    unsigned int i;
+
+    m->replyBits = 0;
+    m->collision = 0;
+    /* No carrier, nothing powered up to answer */
+    if(!(m->regs[REG_TX_CONTROL] & 0x03)) return;
+
+    for(; t < m->tagCnt; ++t) {
+        if(!TagReceive(m, &m->tags[t], out, &bits, &offset)) continue;
+        if(!any) {
+            memcpy(m->reply, out, sizeof(out));
+            m->replyBits = bits;
+            m->collision = offset;
+            any = 1;
+            continue;
+        }
+        for(i = 0; i < bits || i < m->replyBits; ++i) {
+            if(i < bits && i < m->replyBits && Bit(out, i) == Bit(m->reply, i)) continue;
+            if(first < 0 || (int) i < first) first = i;
+            break;
+        }
+        if(bits > m->replyBits) m->replyBits = bits;
+    }
+    if(first < 0) {
+        m->collision = 0;
+        return;
+    }
+    /* ValuesAfterColl clear, everything from the collision on reads as 0 */
+    if(!(m->regs[REG_COLL] & 0x80)) {
+        for(i = first; i < m->replyBits; ++i) PutBit(m->reply, i, 0);
+    }
+    m->collision += first + 1;
+}
+
+/****** RF *******/
+
+static void ReceiveDone(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    unsigned int align = (m->regs[REG_BIT_FRAMING] >> 4) & 0x07;
+    uint8_t dat[MODEL_MAX_FRAME + 1];
+    unsigned int total = align + m->replyBits;
+    unsigned int i = 0;
+
+    m->rfEvent = -1;
+    memset(dat, 0, sizeof(dat));
+    for(; i < m->replyBits; ++i) {
+        PutBit(dat, align + i, Bit(m->reply, i));
+    }
+    for(i = 0; i < (total + 7) / 8; ++i) {
+        Push(m, dat[i]);
+    }
+    SetReg(m, REG_CONTROL, (m->regs[REG_CONTROL] & ~0x07) | (total % 8));
+    if(m->collision) {
+        SetReg(m, REG_ERROR, m->regs[REG_ERROR] | COLL_ERR);
+        SetReg(m, REG_COLL, (m->regs[REG_COLL] & 0x80) | (m->collision <= 32 ? m->collision & 0x1F : 0x20));
+    } else {
+        SetReg(m, REG_COLL, (m->regs[REG_COLL] & 0x80) | 0x20); // CollPosNotValid
+    }
+    m->answered++;
+    RaiseIrq(m, RX_IRQ, 0);
+}
+
+static void SendDone(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    uint64_t start;
+
+    m->rfEvent = -1;
+    SetReg(m, REG_ERROR, 0); // New reception
+    if((m->regs[REG_COMMAND] & 0x0F) == CMD_TRANSCEIVE) Answer(m);
+    else m->replyBits = 0;
+    /* TAuto, runs from the end of the frame until an answer starts */
+    if(m->regs[REG_T_MODE] & 0x80) StartTimer(m);
+    if(m->replyBits) {
+        start = HostNow() + Carrier(m, FDT_CARRIER);
+        if(m->timerEvent < 0 || m->timerEnd > start) {
+            StopTimer(m);
+            m->rfEvent = HostAt(start + FrameCycles(m, m->replyBits), ReceiveDone, m);
+        }
+    }
+    if((m->regs[REG_COMMAND] & 0x0F) == CMD_TRANSMIT) {
+        SetReg(m, REG_COMMAND, (m->regs[REG_COMMAND] & 0xF0) | CMD_IDLE);
+        RaiseIrq(m, TX_IRQ | IDLE_IRQ, 0);
+    } else {
+        RaiseIrq(m, TX_IRQ, 0);
+    }
+}
+
+/* Whatever is in the FIFO goes out, TxLastBits says how much of the last byte */
+static void StartSend(mfrc522Model_t *m)
+{
+    unsigned int last = m->regs[REG_BIT_FRAMING] & 0x07;
+
+    if(m->fifoLen == 0) return;
+    memcpy(m->frame, m->fifo, m->fifoLen);
+    m->frameBits = last ? (m->fifoLen - 1) * 8 + last : m->fifoLen * 8;
+    m->fifoLen = 0;
+    m->frames++;
+    UpdateStatus(m);
+    m->rfEvent = HostAt(HostNow() + FrameCycles(m, m->frameBits), SendDone, m);
+}
+
+/****** Commands *******/
+
+static void EndCommand(mfrc522Model_t *m)
+{
+    m->cmdEvent = -1;
+    SetReg(m, REG_COMMAND, (m->regs[REG_COMMAND] & 0xF0) | CMD_IDLE);
+    RaiseIrq(m, IDLE_IRQ, 0);
+}
+
+/* With an empty FIFO the internal buffer comes out, otherwise the FIFO goes in */
+static void MemDone(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    unsigned int i = 0;
+
+    if(m->fifoLen == 0) {
+        for(; i < sizeof(m->buffer); ++i) Push(m, m->buffer[i]);
+    } else {
+        for(; i < sizeof(m->buffer) && m->fifoLen; ++i) m->buffer[i] = Pop(m);
+    }
+    EndCommand(m);
+}
+
+static void RandomDone(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    unsigned int i = 0;
+
+    for(; i < 10; ++i) m->buffer[i] = ModelRandom(m) >> 24;
+    EndCommand(m);
+}
+
+static void CalcCrc(mfrc522Model_t *m)
+{
+    uint16_t crc = Crc(crcPresets[m->regs[REG_MODE] & 0x03], m->fifo, m->fifoLen);
+
+    m->fifoLen = 0;
+    SetReg(m, REG_CRC_RESULT_H, crc >> 8);
+    SetReg(m, REG_CRC_RESULT_L, crc & 0xFF);
+    SetReg(m, REG_STATUS1, m->regs[REG_STATUS1] | STATUS_CRC_READY);
+    RaiseIrq(m, 0, CRC_IRQ);
+}
+
+/* Starting anything, Idle included, stops what was running */
+static void StartCommand(mfrc522Model_t *m, uint8_t cmd)
+{
+    HostCancel(m->cmdEvent);
+    HostCancel(m->rfEvent);
+    m->cmdEvent = -1;
+    m->rfEvent = -1;
+    StopTimer(m);
+    m->regs[REG_COMMAND] = (m->regs[REG_COMMAND] & 0xF0) | cmd;
+
+    switch(cmd) {
+        case CMD_IDLE:
+        case CMD_TRANSCEIVE: // Waits for StartSend
+        case CMD_RECEIVE:
+            break;
+        case CMD_MEM:
+            m->cmdEvent = HostAt(HostNow() + Microseconds(MEM_US), MemDone, m);
+            break;
+        case CMD_GENERATE_RANDOM:
+            m->cmdEvent = HostAt(HostNow() + Microseconds(RANDOM_US), RandomDone, m);
+            break;
+        case CMD_CALC_CRC:
+            CalcCrc(m);
+            break;
+        case CMD_TRANSMIT:
+            StartSend(m);
+            break;
+        case CMD_SOFT_RESET:
+            ResetRegisters(m);
+            UpdateIrq(m);
+            break;
+        default:
+            EndCommand(m);
+            break;
+    }
+    UpdateIrq(m);
+}
+
+static uint8_t ReadReg(mfrc522Model_t *m, uint8_t reg)
+{
+    uint8_t b;
+
+    switch(reg) {
+        case REG_FIFO_DATA:
+            b = Pop(m);
+            UpdateStatus(m);
+            return b;
+        case REG_T_COUNTER_H:
+            return TimerValue(m) >> 8;
+        case REG_T_COUNTER_L:
+            return TimerValue(m) & 0xFF;
+        default:
+            return m->regs[reg];
+    }
+}
+
+static void WriteReg(mfrc522Model_t *m, uint8_t reg, uint8_t val)
+{
+    switch(reg) {
+        case REG_COMMAND:
+            m->regs[reg] = (val & 0x30) | (m->regs[reg] & 0x0F);
+            StartCommand(m, val & 0x0F);
+            break;
+        case REG_COM_IRQ:
+        case REG_DIV_IRQ:
+            /* Set1 picks whether the marked bits are set or cleared */
+            if(val & 0x80) m->regs[reg] |= val & 0x7F;
+            else m->regs[reg] &= ~(val & 0x7F);
+            if(reg == REG_DIV_IRQ && (val & CRC_IRQ) && !(val & 0x80)) {
+                SetReg(m, REG_STATUS1, m->regs[REG_STATUS1] & ~STATUS_CRC_READY);
+            }
+            UpdateIrq(m);
+            break;
+        case REG_COM_IEN:
+        case REG_DIV_IEN:
+            m->regs[reg] = val;
+            UpdateIrq(m);
+            break;
+        case REG_FIFO_DATA:
+            Push(m, val);
+            UpdateStatus(m);
+            break;
+        case REG_FIFO_LEVEL:
+            if(val & 0x80) Flush(m);
+            UpdateStatus(m);
+            break;
+        case REG_BIT_FRAMING:
+            m->regs[reg] = val & 0x7F;
+            if((val & 0x80) && (m->regs[REG_COMMAND] & 0x0F) == CMD_TRANSCEIVE && m->rfEvent < 0) StartSend(m);
+            break;
+        case REG_COLL:
+            m->regs[reg] = (val & 0x80) | (m->regs[reg] & 0x7F);
+            break;
+        case REG_ERROR:
+        case REG_STATUS1:
+        case REG_CONTROL:
+        case REG_CRC_RESULT_H:
+        case REG_CRC_RESULT_L:
+        case REG_T_COUNTER_H:
+        case REG_T_COUNTER_L:
+        case REG_VERSION:
+            break; // Read only, or only action bits this model doesn't use
+        default:
+            m->regs[reg] = val;
+            break;
+    }
+}
+
+/****** SPI *******/
+
+static void Select(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    m->pos = 0;
+    m->next = 0;
+}
+
+/*
+ * First byte is the address. A read clocks its register out during the
+ * next byte, which is itself the next address, so reads pipeline. A write
+ * puts every byte after the address into the same register.
+ */
+static uint8_t SpiExchange(void *ctx, uint8_t tx)
+{
+    mfrc522Model_t *m = ctx;
+    uint8_t out = m->next;
+
+    if(m->pos++ == 0) {
+        m->reading = (tx & 0x80) != 0;
+        m->reg = (tx >> 1) & 0x3F;
+        m->next = m->reading ? ReadReg(m, m->reg) : 0;
+        return 0;
+    }
+    if(m->reading) {
+        m->next = (tx & 0x80) ? ReadReg(m, (tx >> 1) & 0x3F) : 0;
+    } else {
+        WriteReg(m, m->reg, tx);
+        m->next = 0;
+    }
+    return out;
+}
+
+static void Deselect(void *ctx)
+{
+    mfrc522Model_t *m = ctx;
+    m->pos = 0;
+}
+
+void ModelInit(mfrc522Model_t *m, uint8_t addr, volatile unsigned int *irqPort, unsigned int irqMask,
+        volatile unsigned int *cnEnable, unsigned int cnMask, uint32_t seed)
+{
+    hostSpiDevice_t dev = { Select, SpiExchange, Deselect, m };
+
+    memset(m, 0, sizeof(*m));
+    m->irqPort = irqPort;
+    m->irqMask = irqMask;
+    m->cnEnable = cnEnable;
+    m->cnMask = cnMask;
+    m->cmdEvent = -1;
+    m->rfEvent = -1;
+    m->timerEvent = -1;
+    m->seed = seed ? seed : 1;
+    ResetRegisters(m);
+    UpdateIrq(m);
+    memset(m->changed, 0, sizeof(m->changed));
+    HostSpiAttach(addr, &dev);
+}
+
+modelTag_t *ModelAddTag(mfrc522Model_t *m, const uint8_t *uid, uint8_t len)
+{
+    modelTag_t *tag;
+
+    if(m->tagCnt >= MODEL_MAX_TAGS || (len != 4 && len != 7 && len != 10)) return 0;
+    tag = &m->tags[m->tagCnt++];
+    memcpy(tag->uid, uid, len);
+    tag->uidLen = len;
+    tag->st = TagIdle;
+    tag->level = 0;
+    return tag;
+}
+
+static void RandomUid(mfrc522Model_t *m, uint8_t *uid, uint8_t len)
+{
+    unsigned int i = 0;
+
+    for(; i < len; ++i) {
+        /* A cascade tag where UID bytes go would read as another level */
+        do uid[i] = ModelRandom(m) >> 24; while(uid[i] == PICC_CT);
+    }
+}
+
+modelTag_t *ModelNewTag(mfrc522Model_t *m, uint8_t len)
+{
+    uint8_t uid[10];
+
+    RandomUid(m, uid, len);
+    return ModelAddTag(m, uid, len);
+}
+
+void ModelRenewTag(mfrc522Model_t *m, modelTag_t *tag)
+{
+    RandomUid(m, tag->uid, tag->uidLen);
+    tag->st = TagIdle;
+    tag->level = 0;
+}
+
+void ModelRemoveTag(mfrc522Model_t *m, modelTag_t *tag)
+{
+    unsigned int i = tag - m->tags;
+
+    if(i >= m->tagCnt) return;
+    memmove(&m->tags[i], &m->tags[i + 1], (m->tagCnt - i - 1) * sizeof(modelTag_t));
+    m->tagCnt--;
+}
@@ -0,0 +1,100 @@
+#ifndef __MFRC522_MODEL_H_
+#define	__MFRC522_MODEL_H_
+
+#include "hostChip.h"
+
+#define MODEL_REGISTERS 64
+#define MODEL_FIFO_SIZE 64
+#define MODEL_MAX_TAGS 8
+#define MODEL_MAX_FRAME 16
+
+enum modelTagStates {
+    TagIdle,
+    TagReady,
+    TagActive,
+    TagHalt,
+};
+
+/* ISO 14443A tag in the reader's field */
+typedef struct {
+    uint8_t uid[10];
+    uint8_t uidLen; // 4, 7 or 10
+    enum modelTagStates st;
+    uint8_t level;  // Cascade level it answers to while Ready
+} modelTag_t;
+
+/*
+ * One MFRC522 on SPI1 with its own field of tags. Registers, the FIFO, the
+ * SPI framing, the IRQ pin, the commands the driver uses and the timer are
+ * modelled. RF frames take their air time at 106 kbit/s, and a tag answers
+ * after the usual frame delay. Anticollision follows the driver: CollPos
+ * counts from the first bit of UID CLn, and bits after a collision come
+ * back cleared when ValuesAfterColl is 0.
+ */
+typedef struct mfrc522Model {
+    uint8_t regs[MODEL_REGISTERS];
+    uint8_t fifo[MODEL_FIFO_SIZE];
+    uint8_t fifoLen;
+    uint8_t buffer[25]; // Internal buffer Mem and GenerateRandomID work on
+
+    /* Chip-select window */
+    unsigned int pos;
+    uint8_t reg;
+    unsigned reading : 1;
+    uint8_t next;       // Clocked out on the next byte
+
+    /* Pins */
+    volatile unsigned int *irqPort;
+    unsigned int irqMask;
+    volatile unsigned int *cnEnable;
+    unsigned int cnMask;
+
+    /* Pending work, -1 when there is none */
+    int cmdEvent;
+    int rfEvent;
+    int timerEvent;
+    uint64_t timerStart;
+    uint64_t timerEnd;
+
+    uint8_t frame[MODEL_FIFO_SIZE];
+    unsigned int frameBits;
+    uint8_t reply[MODEL_MAX_FRAME];
+    unsigned int replyBits;
+    int collision;      // CollPos to report, 0 when there was none
+
+    modelTag_t tags[MODEL_MAX_TAGS];
+    unsigned int tagCnt;
+    /* Called when a tag takes HLTA, it may change the tag in place but not add or remove any */
+    void (*halted)(struct mfrc522Model *m, modelTag_t *tag);
+
+    uint32_t seed;
+    uint16_t changed[MODEL_REGISTERS / 16]; // Registers the chip has changed on its own
+
+    unsigned long frames; // Sent by the reader
+    unsigned long answered;
+} mfrc522Model_t;
+
+#ifdef	__cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    /* addr is the chip-select address spiDriver captures under */
+    void ModelInit(mfrc522Model_t *m, uint8_t addr, volatile unsigned int *irqPort, unsigned int irqMask,
+            volatile unsigned int *cnEnable, unsigned int cnMask, uint32_t seed);
+
+    modelTag_t *ModelAddTag(mfrc522Model_t *m, const uint8_t *uid, uint8_t len);
+    /* Fresh tag with a random UID of len bytes */
+    modelTag_t *ModelNewTag(mfrc522Model_t *m, uint8_t len);
+    /* Same tag slot, new random UID, as if one tag left and another came in */
+    void ModelRenewTag(mfrc522Model_t *m, modelTag_t *tag);
+    void ModelRemoveTag(mfrc522Model_t *m, modelTag_t *tag);
+
+    uint32_t ModelRandom(mfrc522Model_t *m);
+    /* CRC_A as the coprocessor computes it with a 0x6363 preset */
+    uint16_t ModelCrcA(const uint8_t *dat, unsigned int len);
+
+#ifdef	__cplusplus
+}
+#endif /* __cplusplus */
+
+#endif	/* __MFRC522_MODEL_H_ */
@@ -0,0 +1,107 @@
+/*
+ * File:   xc.h
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:55 PM
+ *
+ * Stands in for the XC16 device header when the drivers are built for the
+ * host with plain cc. Put this directory on the include path and the
+ * firmware sources pick it up unchanged. Every SFR is an ordinary variable
+ * with a bits struct next to it that has every field name, except for the
+ * few the simulated chip has to see as they happen (see hostChip.c):
+ *   SPI1BUF, SPI1STATbits - blocking byte exchange
+ *   DMA0REQbits           - only ever touched to FORCE a transfer
+ *   I2C1CONbits, I2C1STATbits, I2C1TRN, I2C1RCV - I2C master events
+ *   TMR1                  - read off the simulated clock
+ *   Idle()                - runs the clock up to the next event
+ */
+
+#ifndef __HOST_XC_H_
+#define	__HOST_XC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Attributes only XC16 knows */
+#define interrupt
+#define no_auto_psv
+#define space(x)
+
+typedef struct {
+    /* SPI */
+    unsigned SPITBF, SPIRBF, SPIROV, SPIEN, SPISIDL, MODE16, CKE, CKP, MSTEN, SPRE, PPRE, SMP, SSEN;
+    /* Peripheral pin select */
+    unsigned SDI1R, RP13R, RP14R, RP7R, U1RXR;
+    /* Ports */
+    unsigned TRISA0, TRISA1, TRISA2, RA0, RA1, LATA0, LATA1, ODCB8, ODCB9;
+    /* DMA */
+    unsigned SIZE, DIR, HALF, NULLW, AMODE, MODE, CHEN, FORCE, IRQSEL;
+    /* Interrupts */
+    unsigned T1IF, T1IE, T2IF, T2IE, T3IF, T3IE, CNIF, CNIE, DMA0IF, DMA0IE, DMA1IF, DMA1IE, DMA2IF, DMA2IE;
+    unsigned MI2C1IF, MI2C1IE, SI2C1IF, SI2C1IE, U1TXIF, U1TXIE;
+    /* Timers */
+    unsigned TON, TSIDL, TGATE, TCKPS, T32, TCS;
+    /* I2C */
+    unsigned I2CEN, I2CSIDL, SCLREL, A10M, SEN, RSEN, PEN, RCEN, ACKEN, ACKDT, ACKSTAT, TRSTAT, BCL, IWCOL, TBF, RBF;
+    /* UART */
+    unsigned UARTEN, USIDL, BRGH, PDSEL, STSEL, UTXEN, UTXBF, TRMT, UTXISEL0, UTXISEL1;
+} hostBits_t;
+
+#define HOST_SFR(name) extern volatile unsigned int name; extern volatile hostBits_t name##bits
+
+HOST_SFR(AD1PCFGL);
+HOST_SFR(TRISA); HOST_SFR(TRISB);
+HOST_SFR(PORTA); HOST_SFR(PORTB);
+HOST_SFR(LATA); HOST_SFR(LATB);
+HOST_SFR(ODCB);
+HOST_SFR(CNEN1); HOST_SFR(CNEN2);
+HOST_SFR(RPINR18); HOST_SFR(RPINR20);
+HOST_SFR(RPOR3); HOST_SFR(RPOR6); HOST_SFR(RPOR7);
+HOST_SFR(IFS0); HOST_SFR(IFS1); HOST_SFR(IFS4);
+HOST_SFR(IEC0); HOST_SFR(IEC1); HOST_SFR(IEC4);
+HOST_SFR(T1CON); HOST_SFR(T2CON); HOST_SFR(T3CON);
+HOST_SFR(SPI1CON1); HOST_SFR(SPI1CON2);
+HOST_SFR(DMA0CON); HOST_SFR(DMA1CON); HOST_SFR(DMA2CON);
+HOST_SFR(DMA1REQ);
+HOST_SFR(U1MODE); HOST_SFR(U1STA);
+
+extern volatile unsigned int SPI1STAT;
+extern volatile unsigned int DMA0REQ, DMA2REQ;
+extern volatile unsigned int DMA0STA, DMA0PAD, DMA0CNT;
+extern volatile unsigned int DMA1STA, DMA1PAD, DMA1CNT;
+extern volatile unsigned int DMA2STA, DMA2PAD, DMA2CNT;
+extern volatile unsigned int PR1, PR2, PR3, TMR2, TMR3, TMR3HLD;
+extern volatile unsigned int I2C1CON, I2C1STAT, I2C1BRG, I2C1ADD, I2C1MSK;
+extern volatile unsigned int U1BRG, U1TXREG;
+
+/* Go through the simulated chip, see hostChip.c */
+#define SPI1BUF      (*HostSpiBuf())
+#define SPI1STATbits (*HostSpiStat())
+#define DMA0REQbits  (*HostDmaForce())
+#define DMA2REQbits  (*HostUartForce())
+#define I2C1CONbits  (*HostI2cCon())
+#define I2C1STATbits (*HostI2cStat())
+#define I2C1TRN      (*HostI2cTrn())
+#define I2C1RCV      (*HostI2cRcv())
+#define TMR1         (*HostTimer())
+
+volatile unsigned int *HostSpiBuf();
+volatile hostBits_t *HostSpiStat();
+volatile hostBits_t *HostDmaForce();
+volatile hostBits_t *HostUartForce();
+volatile hostBits_t *HostI2cCon();
+volatile hostBits_t *HostI2cStat();
+volatile unsigned int *HostI2cTrn();
+volatile unsigned int *HostI2cRcv();
+volatile unsigned int *HostTimer();
+
+unsigned int HostDmaOffset(void *buf);
+void HostIdle();
+
+#define __builtin_dmaoffset(buf) HostDmaOffset(buf)
+#define __builtin_disi(x) ((void)0)
+#define Idle() HostIdle()
+#define Nop() ((void)0)
+#define ClrWdt() ((void)0)
+
+#endif	/* __HOST_XC_H_ */
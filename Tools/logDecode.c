@@ -0,0 +1,216 @@
+/*
+ * File:   logDecode.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 9:40 PM
+ *
+ * Host side decoder for the UART log (Common/uartDriver.h). Reads a raw
+ * capture of the serial line, checks every record and prints it, then sums
+ * up what the link carried. LOG_TRACE payloads can be pulled out into a dump
+ * for traceDecode with -t, and LOG_CAPTURE into a bus capture for busReport
+ * with -c.
+ *
+ *   cc -o logDecode logDecode.c
+ *   ./logDecode capture.bin [-b baud] [-t trace.bin] [-c bus.bin] [-q]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// Same framing and types as Common/uartDriver.h
+#define LOG_SYNC 0xA5
+#define LOG_MAX_PAYLOAD 64
+
+#define LOG_TEXT     0x00
+#define LOG_UID      0x01
+#define LOG_COUNTERS 0x02
+#define LOG_TRACE    0x03
+#define LOG_LATENCY  0x04
+#define LOG_CAPTURE  0x05
+
+enum states {
+    Sync,
+    Type,
+    Length,
+    Payload,
+    Check,
+};
+
+static struct {
+    enum states st;
+    uint8_t type;
+    uint8_t len;
+    uint8_t payload[LOG_MAX_PAYLOAD];
+    uint8_t cnt;
+    uint8_t sum;
+
+    unsigned long bytes;
+    unsigned long records[256];
+    unsigned long good;
+    unsigned long bad;
+    unsigned long skipped; // Bytes thrown away looking for a sync
+    unsigned long payloadBytes;
+
+    FILE *trace;
+    FILE *bus;
+    int quiet;
+} _module;
+
+unsigned long Long(const uint8_t *b)
+{
+    return b[0] | (b[1] << 8) | ((unsigned long) b[2] << 16) | ((unsigned long) b[3] << 24);
+}
+
+void PrintRecord()
+{
+    int i = 0;
+
+    switch(_module.type) {
+        case LOG_TEXT:
+            printf("text     %.*s\n", _module.len, (char *) _module.payload);
+            break;
+        case LOG_UID:
+            if(_module.len < 1) break;
+            printf("%-8s reader %u uid ", (_module.payload[0] & 0x80) ? "depart" : "arrive", _module.payload[0] & 0x7F);
+            for(i = 1; i < _module.len; ++i) printf("%02X", _module.payload[i]);
+            printf("\n");
+            break;
+        case LOG_COUNTERS:
+            printf("counters");
+            for(; i + 1 < _module.len; i += 2) printf(" %u", _module.payload[i] | (_module.payload[i + 1] << 8));
+            printf("\n");
+            break;
+        case LOG_TRACE:
+            printf("trace    %u entries\n", _module.len / 6);
+            break;
+        case LOG_CAPTURE:
+            printf("capture  %u bytes\n", _module.len);
+            break;
+        case LOG_LATENCY:
+            /* Last/max pairs per stage, overruns at the end */
+            printf("latency ");
+            for(; i + 8 <= _module.len - 4; i += 8) printf(" %lu/%lu", Long(&_module.payload[i]), Long(&_module.payload[i + 4]));
+            printf(" us");
+            if(_module.len >= 4) printf(", %lu over budget", Long(&_module.payload[_module.len - 4]));
+            printf("\n");
+            break;
+        default:
+            printf("type %02X  %u bytes\n", _module.type, _module.len);
+            break;
+    }
+}
+
+void RecordDone()
+{
+    _module.good++;
+    _module.records[_module.type]++;
+    _module.payloadBytes += _module.len;
+    if(_module.type == LOG_TRACE && _module.trace) {
+        fwrite(_module.payload, 1, _module.len, _module.trace);
+    }
+    if(_module.type == LOG_CAPTURE && _module.bus) {
+        fwrite(_module.payload, 1, _module.len, _module.bus);
+    }
+    if(!_module.quiet) PrintRecord();
+}
+
+void Feed(uint8_t b)
+{
+    _module.bytes++;
+    switch(_module.st) {
+        case Sync:
+            if(b == LOG_SYNC) _module.st = Type;
+            else _module.skipped++;
+            break;
+        case Type:
+            _module.type = b;
+            _module.sum = b;
+            _module.st = Length;
+            break;
+        case Length:
+            _module.len = b;
+            _module.sum += b;
+            _module.cnt = 0;
+            if(b > LOG_MAX_PAYLOAD) {
+                _module.bad++;
+                _module.st = Sync;
+            } else {
+                _module.st = b ? Payload : Check;
+            }
+            break;
+        case Payload:
+            _module.payload[_module.cnt++] = b;
+            _module.sum += b;
+            if(_module.cnt >= _module.len) _module.st = Check;
+            break;
+        case Check:
+            _module.sum += b;
+            if(_module.sum == 0) RecordDone();
+            else _module.bad++;
+            _module.st = Sync;
+            break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    FILE *f;
+    const char *capture = 0;
+    unsigned long baud = 460800;
+    double lineRate;
+    double avg;
+    int c;
+    int i;
+
+    for(i = 1; i < argc; ++i) {
+        if(strcmp(argv[i], "-b") == 0 && i + 1 < argc) baud = strtoul(argv[++i], 0, 0);
+        else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            _module.trace = fopen(argv[++i], "wb");
+            if(!_module.trace) {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            _module.bus = fopen(argv[++i], "wb");
+            if(!_module.bus) {
+                perror(argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "-q") == 0) _module.quiet = 1;
+        else capture = argv[i];
+    }
+    if(!capture) {
+        fprintf(stderr, "usage: %s capture.bin [-b baud] [-t trace.bin] [-c bus.bin] [-q]\n", argv[0]);
+        return 1;
+    }
+
+    f = fopen(capture, "rb");
+    if(!f) {
+        perror(capture);
+        return 1;
+    }
+    while((c = fgetc(f)) != EOF) Feed(c);
+    fclose(f);
+    if(_module.trace) fclose(_module.trace);
+    if(_module.bus) fclose(_module.bus);
+
+    /* 8N1, ten bits on the wire for every byte */
+    lineRate = baud / 10.0;
+    avg = _module.good ? (double) (_module.bytes - _module.skipped) / _module.good : 0;
+
+    printf("\n%lu bytes, %lu records, %lu bad, %lu bytes skipped\n", _module.bytes, _module.good, _module.bad, _module.skipped);
+    printf("text %lu, uid %lu, counters %lu, trace %lu, latency %lu, capture %lu\n", _module.records[LOG_TEXT], _module.records[LOG_UID],
+            _module.records[LOG_COUNTERS], _module.records[LOG_TRACE], _module.records[LOG_LATENCY], _module.records[LOG_CAPTURE]);
+    if(_module.good) {
+        printf("%.1f bytes per record, %.1f%% framing overhead\n", avg,
+                100.0 * (_module.bytes - _module.skipped - _module.payloadBytes) / (_module.bytes - _module.skipped));
+        printf("at %lu baud: %.0f bytes/s, %.0f records/s of this mix, %.1f ms of line time for this capture\n",
+                baud, lineRate, lineRate / avg, _module.bytes / lineRate * 1000.0);
+    }
+    return 0;
+}
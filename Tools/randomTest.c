@@ -0,0 +1,203 @@
+/*
+ * File:   randomTest.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 12:05 AM
+ *
+ * Random bits and SPI bytes it takes to get one dice roll (a value 0-5) out
+ * of the MFRC522, old way against new, both on the MFRC522 model in
+ * Tools/host.
+ *
+ *   old - the original GetRandomFromRFID: flush, GenerateRandomID, Mem,
+ *         poll FifoLevel for 25, read 10 bytes, keep two of them as a 16-bit
+ *         value, flush, and start over while the value is above 5
+ *   new - RFID-Reader.X/random.c, a pool refilled 10 bytes a batch and
+ *         RandomBelow(6) taking bits off it with the Fast Dice Roller
+ *
+ * Bus bytes depend on how long the model takes over GenerateRandomID and
+ * Mem, since the old code polls CommandReg until they finish.
+ *
+ *   cc -DBUS_CAPTURE=1 -I host -o randomTest randomTest.c host/hostChip.c host/mfrc522Model.c host/hostReaders.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/random.c ../Common/scheduler.c
+ *   ./randomTest [-o old values] [-n new values]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host/hostChip.h"
+#include "host/mfrc522Model.h"
+#include "host/hostReaders.h"
+#include "../RFID-Reader.X/global.h"
+#include "../RFID-Reader.X/spiDriver.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/random.h"
+#include "../Common/scheduler.h"
+
+#define SIDES 6
+
+typedef struct {
+    unsigned long values;
+    unsigned long bits;  // Random bits taken off the reader
+    unsigned long bytes; // SPI bytes clocked
+    uint64_t cycles;
+    unsigned long counts[SIDES];
+} result_t;
+
+static struct {
+    mfrc522Model_t chip;
+    mfrc522_t rdr;
+} _module;
+
+static void Setup()
+{
+    HostReadersInit();
+    HostReaderAttach(0, &_module.chip, &_module.rdr, 1);
+}
+
+/****** Old *******/
+
+static void OldWaitUntilNopCommand()
+{
+    SendSPIByte(READ_ADDRESS(COMMAND_REG));
+    while((SendReceiveSPIByte(READ_ADDRESS(COMMAND_REG)) & 0x0F) != 0x00) ;
+    SendSPIByte(0); // End read
+}
+
+static void OldFlush()
+{
+    StartTransaction(&_module.rdr.spi);
+    SendSPIByte(WRITE_ADDRESS(FIFO_LEVEL_REG));
+    SendSPIByte(0x80);
+    EndTransaction();
+    StartTransaction(&_module.rdr.spi);
+    OldWaitUntilNopCommand();
+    EndTransaction();
+}
+
+static void OldCommand(uint8_t cmd)
+{
+    StartTransaction(&_module.rdr.spi);
+    SendSPIByte(WRITE_ADDRESS(COMMAND_REG));
+    SendSPIByte(cmd);
+    EndTransaction();
+    StartTransaction(&_module.rdr.spi);
+    OldWaitUntilNopCommand();
+    EndTransaction();
+}
+
+/* Byte for byte what the first GetRandomFromRFID put on the bus */
+static unsigned int OldGetRandomFromRFID()
+{
+    uint8_t dat[11];
+    unsigned int i = 0;
+
+    OldFlush();
+    OldCommand(CMD_GENERATE_RANDOM);
+    OldCommand(CMD_MEM);
+
+    StartTransaction(&_module.rdr.spi);
+    SendSPIByte(READ_ADDRESS(FIFO_LEVEL_REG)); // Prep read
+    while(SendReceiveSPIByte(READ_ADDRESS(FIFO_LEVEL_REG)) != 25) ;
+    SendSPIByte(0); // End read
+    EndTransaction();
+
+    /* Each read comes back on the next byte, so dat[1..10] are the first 10 FIFO bytes */
+    StartTransaction(&_module.rdr.spi);
+    for(; i < 11; ++i) {
+        dat[i] = SendReceiveSPIByte(i < 10 ? READ_ADDRESS(FIFO_DATA_REG) : 0x00);
+    }
+    EndTransaction();
+
+    OldFlush();
+    return ((unsigned int) dat[3] << 8) | dat[4];
+}
+
+static void Old(unsigned long values, result_t *r)
+{
+    unsigned int random;
+
+    for(; r->values < values; ++r->values) {
+        do {
+            random = OldGetRandomFromRFID();
+            r->bits += 16;
+        } while(random > SIDES - 1);
+        r->counts[random]++;
+    }
+}
+
+/****** New *******/
+
+static void New(unsigned long values, result_t *r)
+{
+    unsigned int random;
+
+    InitRandom(&_module.rdr);
+    while(r->values < values) {
+        RandomProcess();
+        while(r->values < values && RandomBelow(SIDES, &random)) {
+            r->counts[random]++;
+            r->values++;
+        }
+        if(RandomBusy()) Idle();
+    }
+    /* What's left in the pool was generated but not used */
+    r->bits = (RandomGenerated() - RandomAvailable()) * 8;
+}
+
+/* Both share one reader, so each is measured from where the last left the bus and the clock */
+static void Measure(void (*fn)(unsigned long values, result_t *r), unsigned long values, result_t *r)
+{
+    hostBusStats_t before;
+    hostBusStats_t after;
+    uint64_t start = HostNow();
+
+    memset(r, 0, sizeof(*r));
+    GetHostBusStats(&before);
+    (*fn)(values, r);
+    GetHostBusStats(&after);
+    r->bytes = after.bytes - before.bytes;
+    r->cycles = HostNow() - start;
+}
+
+static void Print(const char *name, const result_t *r)
+{
+    unsigned int i = 0;
+
+    printf("%-4s %8lu  %12.1f  %15.1f  %10.1f ", name, r->values, (double) r->bits / r->values,
+            (double) r->bytes / r->values, HostUs(r->cycles) / r->values);
+    for(; i < SIDES; ++i) {
+        printf(" %5.3f", (double) r->counts[i] / r->values);
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    result_t old;
+    result_t new;
+    unsigned long oldValues = 100;
+    unsigned long newValues = 60000;
+    int n;
+
+    for(n = 1; n < argc; ++n) {
+        if(strcmp(argv[n], "-o") == 0 && n + 1 < argc) oldValues = atol(argv[++n]);
+        else if(strcmp(argv[n], "-n") == 0 && n + 1 < argc) newValues = atol(argv[++n]);
+        else break;
+    }
+    if(n < argc || oldValues == 0 || newValues == 0) {
+        fprintf(stderr, "usage: %s [-o old values] [-n new values]\n", argv[0]);
+        return 1;
+    }
+
+    Setup();
+    Measure(Old, oldValues, &old);
+    Measure(New, newValues, &new);
+
+    printf("values 0-%u, MFRC522 model at Fcy %.1f MHz\n", SIDES - 1, CLOCK_RATE / 1e6);
+    printf("%-4s %8s  %12s  %15s  %10s  share of each value\n", "", "values", "bits/value", "SPI bytes/value", "us/value");
+    Print("old", &old);
+    Print("new", &new);
+    return 0;
+}
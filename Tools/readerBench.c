@@ -0,0 +1,305 @@
+/*
+ * File:   readerBench.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 11:58 PM
+ *
+ * Tag reads per second and detection latency of the RFID-Reader card
+ * pipeline, with the firmware's own spiDriver, mfrc522, iso14443a, crcA and
+ * scheduler built for the host and run against the MFRC522 model in
+ * Tools/host. Each row is a fresh run of simulated time at one poll
+ * interval, seeded the same way every time, so results are reproducible.
+ *
+ * Three workloads:
+ *   saturated - the field always holds tags, a halted one is swapped for a
+ *               new one, so this is the most the pipeline can read
+ *   arrivals  - one tag turns up at a random time, leaves once it's read,
+ *               and latency is from its arrival to the UID coming out
+ *   scaling   - saturated, with 1 to MAX_READERS readers on the one bus,
+ *               against what one reader does on its own
+ *
+ * Only SPI and RF take time in the model, the CPU work between bus
+ * accesses is counted as free (see Tools/host/hostChip.c).
+ *
+ *   cc -DBUS_CAPTURE=1 -I host -o readerBench readerBench.c host/hostChip.c host/mfrc522Model.c host/hostReaders.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c \
+ *       ../RFID-Reader.X/crcA.c ../Common/scheduler.c
+ *   ./readerBench [-s seconds] [-t tags in field] [-u uid length] [-p poll ms] [-n readers]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "host/hostChip.h"
+#include "host/mfrc522Model.h"
+#include "host/hostReaders.h"
+#include "../RFID-Reader.X/global.h"
+#include "../RFID-Reader.X/spiDriver.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/iso14443a.h"
+#include "../Common/scheduler.h"
+
+#define ARRIVAL_MIN 20  // ms between one tag leaving and the next turning up
+#define ARRIVAL_MAX 200
+
+static const unsigned int pollIntervals[] = { 0, 1, 2, 5, 10, 20, 50, 100 };
+
+typedef struct {
+    unsigned int seconds;
+    unsigned int tags;
+    uint8_t uidLen;
+    unsigned int readers;
+    unsigned int poll;
+    int arrivals;
+} config_t;
+
+typedef struct {
+    unsigned long reads;
+    unsigned long polls;
+    unsigned long bytes;
+    unsigned long windows;
+    double busy;       // Fraction of the run SCK was going
+    double latencySum; // ms
+    double latencyMax;
+} result_t;
+
+static struct {
+    config_t cfg;
+    mfrc522Model_t chips[MAX_READERS];
+    mfrc522_t readers[MAX_READERS];
+    cardReader_t cards[MAX_READERS];
+    uint64_t arrived[MAX_READERS];
+    result_t result;
+} _module;
+
+static unsigned int RandomMs(mfrc522Model_t *m, unsigned int min, unsigned int max)
+{
+    return min + ModelRandom(m) % (max - min + 1);
+}
+
+static void Arrive(void *ctx)
+{
+    unsigned int i = (mfrc522Model_t *) ctx - _module.chips;
+
+    ModelNewTag(&_module.chips[i], _module.cfg.uidLen);
+    _module.arrived[i] = HostNow();
+}
+
+static void NextArrival(unsigned int i)
+{
+    mfrc522Model_t *m = &_module.chips[i];
+    HostAt(HostNow() + (uint64_t) RandomMs(m, ARRIVAL_MIN, ARRIVAL_MAX) * HostFcy() / 1000, Arrive, m);
+}
+
+/* Saturated field, the halted tag walks off and a new one takes its place */
+static void Replace(mfrc522Model_t *m, modelTag_t *tag)
+{
+    ModelRenewTag(m, tag);
+}
+
+static void Read(unsigned int i)
+{
+    mfrc522Model_t *m = &_module.chips[i];
+    double latency;
+
+    _module.result.reads++;
+    if(!_module.cfg.arrivals) return;
+    latency = HostUs(HostNow() - _module.arrived[i]) / 1000.0;
+    _module.result.latencySum += latency;
+    if(latency > _module.result.latencyMax) _module.result.latencyMax = latency;
+    /* Read and gone, the HLTA on its way out goes to an empty field */
+    while(m->tagCnt) ModelRemoveTag(m, &m->tags[0]);
+    NextArrival(i);
+}
+
+/* Same shape as ReaderTask in RFID-Reader.X/main.c, without the tracker and the pool */
+static void ReaderTask()
+{
+    uint8_t uid[UID_SIZE];
+    unsigned int i = 0;
+
+    for(; i < _module.cfg.readers; ++i) {
+        CardProcess(&_module.cards[i]);
+        if(GetCardUid(&_module.cards[i], uid)) Read(i);
+    }
+}
+
+static void Run(const config_t *cfg, result_t *result)
+{
+    hostBusStats_t bus;
+    cardStats_t stats;
+    uint64_t end;
+    unsigned int i = 0;
+    unsigned int t;
+    int task;
+
+    memset(&_module, 0, sizeof(_module));
+    _module.cfg = *cfg;
+    HostReadersInit();
+    for(; i < cfg->readers; ++i) {
+        mfrc522Model_t *m = &_module.chips[i];
+
+        HostReaderAttach(i, m, &_module.readers[i], 0x1234 + i);
+        CardInit(&_module.cards[i], &_module.readers[i]);
+        SetPollInterval(&_module.cards[i], cfg->poll);
+        if(cfg->arrivals) {
+            NextArrival(i);
+        } else {
+            m->halted = Replace;
+            for(t = 0; t < cfg->tags; ++t) ModelNewTag(m, cfg->uidLen);
+        }
+    }
+    task = TaskCreate(ReaderTask);
+    TaskSchedule(task, 1, 1);
+    SetIrqTask(task);
+
+    end = HostNow() + (uint64_t) cfg->seconds * HostFcy();
+    while(HostNow() < end) {
+        SchedulerProcess();
+    }
+
+    GetHostBusStats(&bus);
+    *result = _module.result;
+    for(i = 0; i < cfg->readers; ++i) {
+        GetCardStats(&_module.cards[i], &stats);
+        result->polls += stats.polls;
+    }
+    result->bytes = bus.bytes;
+    result->windows = bus.windows;
+    result->busy = (double) bus.busy / ((double) cfg->seconds * HostFcy());
+}
+
+/* Every run starts from a clean firmware, so each one goes in its own process */
+static int RunFresh(const config_t *cfg, result_t *result)
+{
+    int fd[2];
+    pid_t pid;
+    ssize_t got;
+
+    if(pipe(fd) < 0) return -1;
+    fflush(stdout);
+    pid = fork();
+    if(pid < 0) return -1;
+    if(pid == 0) {
+        close(fd[0]);
+        Run(cfg, result);
+        if(write(fd[1], result, sizeof(*result)) != sizeof(*result)) _exit(1);
+        _exit(0);
+    }
+    close(fd[1]);
+    got = read(fd[0], result, sizeof(*result));
+    close(fd[0]);
+    waitpid(pid, 0, 0);
+    return got == sizeof(*result) ? 0 : -1;
+}
+
+static void Saturated(config_t cfg, const unsigned int *polls, unsigned int cnt)
+{
+    result_t r;
+    unsigned int i = 0;
+
+    printf("\nsaturated, %u tag%s of %u bytes in the field, a halted one is swapped for a new one\n",
+            cfg.tags, cfg.tags == 1 ? "" : "s", cfg.uidLen);
+    printf("poll ms  reads/s  polls/s  SPI bytes/read  windows/read  SPI busy\n");
+    for(; i < cnt; ++i) {
+        cfg.poll = polls[i];
+        cfg.arrivals = 0;
+        if(RunFresh(&cfg, &r) < 0) {
+            printf("%7u  run failed\n", cfg.poll);
+            continue;
+        }
+        printf("%7u  %7.1f  %7.1f  %14.1f  %12.1f  %7.1f%%\n", cfg.poll, (double) r.reads / cfg.seconds,
+                (double) r.polls / cfg.seconds, r.reads ? (double) r.bytes / r.reads : 0.0,
+                r.reads ? (double) r.windows / r.reads : 0.0, 100.0 * r.busy);
+    }
+}
+
+/* Every reader has its own field, so the bus is all they share */
+static void Scaling(config_t cfg, unsigned int poll)
+{
+    result_t r;
+    double single = 0.0;
+    double rate;
+    unsigned int n = 1;
+
+    printf("\nscaling, saturated at poll %u ms, every reader with its own field\n", poll);
+    printf("readers  reads/s  per reader  vs 1 reader  SPI busy\n");
+    for(; n <= MAX_READERS; ++n) {
+        cfg.readers = n;
+        cfg.poll = poll;
+        cfg.arrivals = 0;
+        if(RunFresh(&cfg, &r) < 0) {
+            printf("%7u  run failed\n", n);
+            continue;
+        }
+        rate = (double) r.reads / cfg.seconds;
+        if(n == 1) single = rate;
+        printf("%7u  %7.1f  %10.1f  %10.2fx  %7.1f%%\n", n, rate, rate / n,
+                single > 0.0 ? rate / single : 0.0, 100.0 * r.busy);
+    }
+}
+
+static void Arrivals(config_t cfg, const unsigned int *polls, unsigned int cnt)
+{
+    result_t r;
+    unsigned int i = 0;
+
+    printf("\narrivals, one %u byte tag every %u-%u ms, gone once read\n", cfg.uidLen, ARRIVAL_MIN, ARRIVAL_MAX);
+    printf("poll ms  tags read  latency avg ms  max ms  SPI bytes/s\n");
+    for(; i < cnt; ++i) {
+        cfg.poll = polls[i];
+        cfg.arrivals = 1;
+        if(RunFresh(&cfg, &r) < 0) {
+            printf("%7u  run failed\n", cfg.poll);
+            continue;
+        }
+        printf("%7u  %9lu  %14.2f  %6.2f  %11.0f\n", cfg.poll, r.reads, r.reads ? r.latencySum / r.reads : 0.0,
+                r.latencyMax, (double) r.bytes / cfg.seconds);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    config_t cfg = { 10, 1, 4, 1, 0, 0 };
+    spiDevice_t dev;
+    unsigned int poll = 0;
+    int onePoll = 0;
+    int n;
+
+    for(n = 1; n < argc; ++n) {
+        if(strcmp(argv[n], "-s") == 0 && n + 1 < argc) cfg.seconds = atoi(argv[++n]);
+        else if(strcmp(argv[n], "-t") == 0 && n + 1 < argc) cfg.tags = atoi(argv[++n]);
+        else if(strcmp(argv[n], "-u") == 0 && n + 1 < argc) cfg.uidLen = atoi(argv[++n]);
+        else if(strcmp(argv[n], "-n") == 0 && n + 1 < argc) cfg.readers = atoi(argv[++n]);
+        else if(strcmp(argv[n], "-p") == 0 && n + 1 < argc) {
+            poll = atoi(argv[++n]);
+            onePoll = 1;
+        } else break;
+    }
+    if(n < argc || cfg.seconds == 0 || cfg.tags == 0 || cfg.tags > MODEL_MAX_TAGS ||
+            (cfg.uidLen != 4 && cfg.uidLen != 7 && cfg.uidLen != 10) ||
+            cfg.readers == 0 || cfg.readers > MAX_READERS) {
+        fprintf(stderr, "usage: %s [-s seconds] [-t tags in field, 1-%u] [-u uid length, 4/7/10] [-p poll ms]"
+                " [-n readers, 1-%u]\n", argv[0], MODEL_MAX_TAGS, MAX_READERS);
+        return 1;
+    }
+
+    HostInit(CLOCK_RATE);
+    printf("MFRC522 model, Fcy %.1f MHz, SCK %.1f MHz, %u s simulated per row, %u reader%s\n", CLOCK_RATE / 1e6,
+            SPIConfigureDevice(&dev, CLOCK_RATE, 10000000, 0, &LATB, 0) / 1e6, cfg.seconds,
+            cfg.readers, cfg.readers == 1 ? "" : "s");
+    printf("SPI and RF take their time, CPU work between bus accesses is not counted\n");
+
+    if(onePoll) {
+        Saturated(cfg, &poll, 1);
+        Arrivals(cfg, &poll, 1);
+    } else {
+        Saturated(cfg, pollIntervals, sizeof(pollIntervals) / sizeof(pollIntervals[0]));
+        Arrivals(cfg, pollIntervals, sizeof(pollIntervals) / sizeof(pollIntervals[0]));
+    }
+    Scaling(cfg, poll);
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * File:   traceDecode.c
+ * Author: Cory
+ *
+ * Created on October 19, 2026, 8:30 PM
+ *
+ * Host side decoder for dumps of the trace ring buffer (Common/trace.h).
+ * Prints every entry and then a per-phase latency breakdown, where a phase
+ * runs from one event to the next event in the same family. Commands run
+ * on several readers at once, so those pair up per reader, which the arg
+ * carries in its high nibble.
+ *
+ *   cc -o traceDecode traceDecode.c
+ *   ./traceDecode dump.bin [fcy in Hz, default 3685000] [-q]
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define ENTRY_SIZE 6 // time (4), id, arg
+#define MAX_PHASES 512
+#define CMD_FAMILY 0x4
+#define MAX_READERS 16
+#define STREAMS (16 + MAX_READERS) // One per family, and one per reader for commands
+
+typedef struct {
+    uint8_t id;
+    const char *name;
+} eventName_t;
+
+/* Same ids as Common/trace.h */
+static const eventName_t eventNames[] = {
+    { 0x10, "task start" },
+    { 0x11, "task end" },
+    { 0x12, "idle" },
+    { 0x20, "i2c state" },
+    { 0x30, "lcd state" },
+    { 0x40, "cmd start" },
+    { 0x41, "cmd done" },
+    { 0x42, "cmd timeout" },
+};
+
+typedef struct {
+    uint8_t id;
+    uint8_t arg;
+    unsigned long cnt;
+    uint64_t total;
+    uint32_t min;
+    uint32_t max;
+} phase_t;
+
+static struct {
+    phase_t phases[MAX_PHASES];
+    unsigned int phaseCnt;
+
+    /* Last event seen in each stream, see Stream */
+    uint32_t lastTime[STREAMS];
+    uint8_t lastId[STREAMS];
+    uint8_t lastArg[STREAMS];
+    int seen[STREAMS];
+} _module;
+
+const char *EventName(uint8_t id)
+{
+    unsigned int i = 0;
+    for(; i < sizeof(eventNames) / sizeof(eventNames[0]); ++i) {
+        if(eventNames[i].id == id) return eventNames[i].name;
+    }
+    return "unknown";
+}
+
+phase_t *FindPhase(uint8_t id, uint8_t arg)
+{
+    unsigned int i = 0;
+    for(; i < _module.phaseCnt; ++i) {
+        if(_module.phases[i].id == id && _module.phases[i].arg == arg) return &_module.phases[i];
+    }
+    if(_module.phaseCnt >= MAX_PHASES) return 0;
+    phase_t *phase = &_module.phases[_module.phaseCnt++];
+    phase->id = id;
+    phase->arg = arg;
+    phase->cnt = 0;
+    phase->total = 0;
+    phase->min = UINT32_MAX;
+    phase->max = 0;
+    return phase;
+}
+
+/* Family in the high nibble of the id, and the reader as well for commands */
+int Stream(uint8_t id, uint8_t arg)
+{
+    int family = id >> 4;
+    if(family == CMD_FAMILY) return 16 + (arg >> 4);
+    return family;
+}
+
+/* Commands print as reader:command, the rest as the plain number */
+const char *ArgText(uint8_t id, uint8_t arg)
+{
+    static char text[8];
+    if((id >> 4) == CMD_FAMILY) snprintf(text, sizeof(text), "%u:%X", arg >> 4, arg & 0x0F);
+    else snprintf(text, sizeof(text), "%u", arg);
+    return text;
+}
+
+void AddEvent(uint32_t time, uint8_t id, uint8_t arg)
+{
+    int stream = Stream(id, arg);
+
+    if(_module.seen[stream]) {
+        /* Unsigned difference, so the counter wrapping doesn't matter */
+        uint32_t len = time - _module.lastTime[stream];
+        phase_t *phase = FindPhase(_module.lastId[stream], _module.lastArg[stream]);
+        if(phase) {
+            phase->cnt++;
+            phase->total += len;
+            if(len < phase->min) phase->min = len;
+            if(len > phase->max) phase->max = len;
+        }
+    }
+    _module.seen[stream] = 1;
+    _module.lastTime[stream] = time;
+    _module.lastId[stream] = id;
+    _module.lastArg[stream] = arg;
+}
+
+int ComparePhase(const void *a, const void *b)
+{
+    const phase_t *pa = a;
+    const phase_t *pb = b;
+    if(pa->id != pb->id) return pa->id - pb->id;
+    return pa->arg - pb->arg;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *f;
+    uint8_t raw[ENTRY_SIZE];
+    double fcy = 3685000.0;
+    double usPerCycle;
+    int quiet = 0;
+    unsigned long entries = 0;
+    uint32_t first = 0;
+    int i;
+
+    if(argc < 2) {
+        fprintf(stderr, "usage: %s dump.bin [fcy] [-q]\n", argv[0]);
+        return 1;
+    }
+    for(i = 2; i < argc; ++i) {
+        if(strcmp(argv[i], "-q") == 0) quiet = 1;
+        else fcy = atof(argv[i]);
+    }
+    usPerCycle = 1000000.0 / fcy;
+
+    f = fopen(argv[1], "rb");
+    if(!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while(fread(raw, 1, ENTRY_SIZE, f) == ENTRY_SIZE) {
+        uint32_t time = raw[0] | (raw[1] << 8) | (raw[2] << 16) | ((uint32_t) raw[3] << 24);
+        uint8_t id = raw[4];
+        uint8_t arg = raw[5];
+
+        if(entries == 0) first = time;
+        if(!quiet) {
+            printf("%12.1f us  %-12s %4s\n", (uint32_t)(time - first) * usPerCycle, EventName(id), ArgText(id, arg));
+        }
+        AddEvent(time, id, arg);
+        entries++;
+    }
+    fclose(f);
+
+    qsort(_module.phases, _module.phaseCnt, sizeof(phase_t), ComparePhase);
+
+    printf("\n%lu entries\n\n", entries);
+    printf("%-12s %4s %8s %12s %10s %10s %10s\n", "phase", "arg", "count", "total us", "avg us", "min us", "max us");
+    for(i = 0; i < (int) _module.phaseCnt; ++i) {
+        phase_t *phase = &_module.phases[i];
+        printf("%-12s %4s %8lu %12.1f %10.1f %10.1f %10.1f\n", EventName(phase->id), ArgText(phase->id, phase->arg), phase->cnt,
+                phase->total * usPerCycle, (double) phase->total / phase->cnt * usPerCycle,
+                phase->min * usPerCycle, phase->max * usPerCycle);
+    }
+    return 0;
+}
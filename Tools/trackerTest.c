@@ -0,0 +1,195 @@
+/*
+ * File:   trackerTest.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 2:40 PM
+ *
+ * Checks RFID-Reader.X/tagTracker.c against the MFRC522 model in
+ * Tools/host, for each UID length:
+ *   - a tag turning up gives one TagArrive with its UID
+ *   - a tag left sitting on the reader gives nothing more
+ *   - a tag lifted off for less than the hold-off gives nothing
+ *   - a tag taken away gives one TagDepart once the hold-off runs out
+ * and prints what a tag left on the reader costs in polling, against the
+ * same time with an empty field.
+ *
+ *   cc -DBUS_CAPTURE=1 -I host -o trackerTest trackerTest.c host/hostChip.c host/mfrc522Model.c host/hostReaders.c \
+ *       ../RFID-Reader.X/spiDriver.c ../RFID-Reader.X/mfrc522.c ../RFID-Reader.X/iso14443a.c \
+ *       ../RFID-Reader.X/crcA.c ../RFID-Reader.X/tagTracker.c ../Common/scheduler.c
+ *   ./trackerTest [-s seconds left on the reader]
+ *
+ * Exits non-zero on the first wrong event.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host/hostChip.h"
+#include "host/mfrc522Model.h"
+#include "host/hostReaders.h"
+#include "../RFID-Reader.X/mfrc522.h"
+#include "../RFID-Reader.X/iso14443a.h"
+#include "../RFID-Reader.X/tagTracker.h"
+#include "../Common/scheduler.h"
+
+#define MAX_EVENTS 8
+#define SETTLE 100   // ms for a tag to be read, or to drop out of the table, before anything is measured
+#define LIFTED 40    // ms off the reader, well inside the hold-off
+#define ARRIVE_MAX 60 // ms, one poll interval and the read itself
+
+static const uint8_t uidLens[] = { 4, 7, 10 };
+
+/* What one stretch of polling took on the bus and in RF frames */
+typedef struct {
+    double bytes;   // SPI bytes a second
+    double windows; // Chip-select windows a second
+    double frames;  // RF frames a second
+    double busy;    // Fraction of the time SCK was going
+} cost_t;
+
+static struct {
+    mfrc522Model_t chip;
+    mfrc522_t rdr;
+    cardReader_t card;
+    tagTracker_t tracker;
+
+    tagEvent_t events[MAX_EVENTS];
+    uint64_t eventAt[MAX_EVENTS];
+    unsigned int eventCnt;
+} _module;
+
+/* Same shape as ReaderTask in RFID-Reader.X/main.c, with one reader and the events kept */
+static void ReaderTask()
+{
+    tagEvent_t ev;
+
+    TrackerProcess(&_module.tracker);
+    while(GetTagEvent(&_module.tracker, &ev)) {
+        if(_module.eventCnt >= MAX_EVENTS) continue;
+        _module.events[_module.eventCnt] = ev;
+        _module.eventAt[_module.eventCnt] = HostNow();
+        _module.eventCnt++;
+    }
+}
+
+static void RunFor(unsigned int ms)
+{
+    uint64_t end = HostNow() + (uint64_t) ms * HostFcy() / 1000;
+    while(HostNow() < end) SchedulerProcess();
+}
+
+static void Measure(unsigned int ms, cost_t *cost)
+{
+    hostBusStats_t before;
+    hostBusStats_t after;
+    unsigned long frames = _module.chip.frames;
+    uint64_t start = HostNow();
+    double seconds;
+
+    GetHostBusStats(&before);
+    RunFor(ms);
+    GetHostBusStats(&after);
+    seconds = HostUs(HostNow() - start) / 1e6;
+    cost->bytes = (after.bytes - before.bytes) / seconds;
+    cost->windows = (after.windows - before.windows) / seconds;
+    cost->frames = (_module.chip.frames - frames) / seconds;
+    cost->busy = HostUs(after.busy - before.busy) / 1e6 / seconds;
+}
+
+/*
+ * Takes the events since the last call, fails unless there is exactly the
+ * one expected. ms is how long after since it came.
+ */
+static int Expect(const char *what, int want, enum tagEventType type, const modelTag_t *tag, uint64_t since,
+        double *ms)
+{
+    const tagEvent_t *ev = &_module.events[0];
+    unsigned int cnt = _module.eventCnt;
+
+    _module.eventCnt = 0;
+    if(cnt == 0 && !want) return 0;
+    if(cnt != (want ? 1 : 0)) {
+        printf("FAIL %u byte UID, %s: %u events, want %u\n", tag->uidLen, what, cnt, want ? 1 : 0);
+        return -1;
+    }
+    if(ev->type != type || ev->uidLen != tag->uidLen || memcmp(ev->uid, tag->uid, tag->uidLen) != 0) {
+        printf("FAIL %u byte UID, %s: got %s of a %u byte UID\n", tag->uidLen, what,
+                ev->type == TagArrive ? "TagArrive" : "TagDepart", ev->uidLen);
+        return -1;
+    }
+    *ms = HostUs(_module.eventAt[0] - since) / 1000.0;
+    return 0;
+}
+
+static int Run(uint8_t uidLen, unsigned int seconds)
+{
+    modelTag_t *tag;
+    modelTag_t saved;
+    cost_t empty;
+    cost_t present;
+    double arrive;
+    double depart;
+    uint64_t start;
+    int task;
+
+    memset(&_module, 0, sizeof(_module));
+    HostReadersInit();
+    HostReaderAttach(0, &_module.chip, &_module.rdr, 0x1234 + uidLen);
+    CardInit(&_module.card, &_module.rdr);
+    TrackerInit(&_module.tracker, &_module.card);
+    task = TaskCreate(ReaderTask);
+    TaskSchedule(task, 1, 1);
+    SetIrqTask(task);
+
+    RunFor(SETTLE);
+    Measure(seconds * 1000, &empty);
+
+    start = HostNow();
+    tag = ModelNewTag(&_module.chip, uidLen);
+    RunFor(ARRIVE_MAX);
+    if(Expect("arrival", 1, TagArrive, tag, start, &arrive) < 0) return -1;
+
+    Measure(seconds * 1000, &present);
+    if(Expect("left on the reader", 0, TagArrive, tag, start, 0) < 0) return -1;
+
+    saved = *tag;
+    ModelRemoveTag(&_module.chip, tag);
+    RunFor(LIFTED);
+    tag = ModelAddTag(&_module.chip, saved.uid, saved.uidLen);
+    RunFor(SETTLE + _module.tracker.holdOff);
+    if(Expect("lifted and put back", 0, TagArrive, tag, start, 0) < 0) return -1;
+
+    saved = *tag;
+    start = HostNow();
+    ModelRemoveTag(&_module.chip, tag);
+    RunFor(_module.tracker.holdOff + SETTLE);
+    if(Expect("taken away", 1, TagDepart, &saved, start, &depart) < 0) return -1;
+
+    printf("%7u %10.1f %10.1f  %7.0f %7.0f  %7.1f %7.1f  %6.1f %6.1f   %5.2f%% %5.2f%%\n", uidLen, arrive, depart,
+            empty.bytes, present.bytes, empty.windows, present.windows, empty.frames, present.frames,
+            100 * empty.busy, 100 * present.busy);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int seconds = 5;
+    unsigned int i = 0;
+
+    if(argc == 3 && strcmp(argv[1], "-s") == 0) seconds = atoi(argv[2]);
+    else if(argc != 1) seconds = 0;
+    if(seconds == 0) {
+        fprintf(stderr, "usage: %s [-s seconds]\n", argv[0]);
+        return 1;
+    }
+
+    printf("one reader, default poll and check intervals, %u s with the field empty and with a tag left on it\n",
+            seconds);
+    printf("UID len  arrive ms  depart ms  SPI bytes/s      windows/s       RF frames/s     SPI busy\n");
+    printf("                               empty     tag    empty     tag   empty    tag    empty    tag\n");
+    for(; i < sizeof(uidLens) / sizeof(uidLens[0]); ++i) {
+        if(Run(uidLens[i], seconds) < 0) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*
+ * File:   uartTest.c
+ * Author: Cory
+ *
+ * Created on October 20, 2026, 4:10 PM
+ *
+ * Checks Common/uartDriver.c against UART1 and DMA2 in Tools/host, with the
+ * line looped back into a record decoder, at each rate InitUART gets near
+ * the usual ones:
+ *   - records written whenever there's room keep the line full, and every
+ *     one comes back whole and in order
+ *   - offered at twice what the line carries, the records that don't come
+ *     back are exactly the ones LogDropped counted, none half sent
+ *   - offered a bit under it, nothing is dropped
+ *
+ *   cc -DBUS_CAPTURE=1 -I host -o uartTest uartTest.c host/hostChip.c ../Common/uartDriver.c
+ *   ./uartTest [-s seconds per rate]
+ *
+ * Exits non-zero on the first check that fails.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host/hostChip.h"
+#include "../Common/uartDriver.h"
+
+#define FCY 3685000       // CLOCK_RATE in the firmware's global.h
+#define FULL_MIN 0.99     // Of the line rate, when the buffer is never let run dry
+#define OFFER_LEN 20      // Payload of the records offered at a fixed rate
+#define DRAIN 50          // ms for what's left in the buffer to go out, 22 ms at 115200
+
+static const unsigned long bauds[] = { 115200, 230400, 460800, 921600 };
+
+enum states {
+    Sync,
+    Type,
+    Length,
+    Payload,
+    Check,
+};
+
+/* Far end of the line, same framing as logDecode */
+static struct {
+    enum states st;
+    uint8_t len;
+    uint8_t cnt;
+    uint8_t sum;
+    uint8_t payload[LOG_MAX_PAYLOAD];
+
+    unsigned long bytes;
+    unsigned long records;
+    unsigned long bad;       // Failed the check, or out of order
+    unsigned long next;      // Sequence number the next record should carry
+} _rx;
+
+static void Receive(void *ctx, uint8_t b)
+{
+    unsigned long seq;
+
+    _rx.bytes++;
+    switch(_rx.st) {
+        case Sync:
+            if(b == LOG_SYNC) _rx.st = Type;
+            else _rx.bad++;
+            return;
+        case Type:
+            _rx.sum = b;
+            _rx.st = Length;
+            return;
+        case Length:
+            _rx.sum += b;
+            _rx.len = b;
+            _rx.cnt = 0;
+            _rx.st = (b == 0) ? Check : (b > LOG_MAX_PAYLOAD) ? Sync : Payload;
+            if(b > LOG_MAX_PAYLOAD) _rx.bad++;
+            return;
+        case Payload:
+            _rx.sum += b;
+            _rx.payload[_rx.cnt++] = b;
+            if(_rx.cnt == _rx.len) _rx.st = Check;
+            return;
+        case Check:
+            _rx.st = Sync;
+            memcpy(&seq, _rx.payload, sizeof(seq));
+            if((uint8_t)(_rx.sum + b) != 0 || _rx.len < sizeof(seq) || seq != _rx.next) {
+                _rx.bad++;
+                return;
+            }
+            _rx.records++;
+            _rx.next++;
+            return;
+    }
+}
+
+/* What one stretch of logging did */
+typedef struct {
+    unsigned long offered;
+    unsigned long accepted;
+    unsigned long bytes;    // Accepted, framing included
+    unsigned long dropped;  // By LogDropped
+    double seconds;
+} run_t;
+
+/* Record carrying the next sequence number, which only moves on if LogRecord takes it */
+static int Offer(unsigned int len, unsigned long *seq, run_t *run)
+{
+    uint8_t payload[LOG_MAX_PAYLOAD];
+
+    memset(payload, *seq, len);
+    memcpy(payload, seq, sizeof(*seq));
+    run->offered++;
+    if(LogRecord(LOG_TEXT, payload, len) < 0) return -1;
+    run->accepted++;
+    run->bytes += len + 4;
+    (*seq)++;
+    return 0;
+}
+
+static int Checked(const char *what, unsigned long baud, const run_t *run, unsigned long rxRecords,
+        unsigned long dropped)
+{
+    unsigned long back = _rx.records - rxRecords;
+
+    if(_rx.bad) {
+        printf("FAIL %lu baud, %s: %lu bad or out of order records\n", baud, what, _rx.bad);
+        return -1;
+    }
+    if(back != run->accepted) {
+        printf("FAIL %lu baud, %s: %lu records back of %lu taken\n", baud, what, back, run->accepted);
+        return -1;
+    }
+    if(LogDropped() - dropped != run->offered - run->accepted) {
+        printf("FAIL %lu baud, %s: LogDropped went up %lu, %lu records weren't taken\n", baud, what,
+                LogDropped() - dropped, run->offered - run->accepted);
+        return -1;
+    }
+    return 0;
+}
+
+/* Keeps the buffer topped up, records getting longer and shorter so the ring wraps everywhere */
+static int Full(unsigned long baud, unsigned int seconds, unsigned long *seq, double *rate)
+{
+    run_t run = { 0 };
+    unsigned long rxBytes = _rx.bytes;
+    unsigned long rxRecords = _rx.records;
+    unsigned long dropped = LogDropped();
+    uint64_t start = HostNow();
+    uint64_t end = start + (uint64_t) seconds * HostFcy();
+    unsigned int len;
+
+    while(HostNow() < end) {
+        len = sizeof(*seq) + (*seq % (LOG_MAX_PAYLOAD - sizeof(*seq) + 1));
+        if(LogFree() < len + 4) {
+            HostIdle();
+            continue;
+        }
+        Offer(len, seq, &run);
+    }
+    /* Only what was on the wire while the buffer was being kept full counts */
+    *rate = (_rx.bytes - rxBytes) / (HostUs(HostNow() - start) / 1e6);
+    HostAdvance(DRAIN * HostFcy() / 1000);
+    return Checked("kept full", baud, &run, rxRecords, dropped);
+}
+
+/* One OFFER_LEN record at a time, load times what the line carries */
+static int Offered(unsigned long baud, unsigned long actual, unsigned int seconds, double load, unsigned long *seq,
+        run_t *run)
+{
+    unsigned long rxRecords = _rx.records;
+    unsigned long dropped = LogDropped();
+    uint64_t start = HostNow();
+    uint64_t end = start + (uint64_t) seconds * HostFcy();
+    double interval = (OFFER_LEN + 4) * 10.0 * HostFcy() / actual / load;
+    unsigned long i = 0;
+
+    memset(run, 0, sizeof(*run));
+    while(HostNow() < end) {
+        HostRunUntil(start + (uint64_t)(i++ * interval));
+        Offer(OFFER_LEN, seq, run);
+    }
+    run->seconds = HostUs(HostNow() - start) / 1e6;
+    run->dropped = LogDropped() - dropped;
+    HostAdvance(DRAIN * HostFcy() / 1000);
+    return Checked(load > 1 ? "overloaded" : "under the line rate", baud, run, rxRecords, dropped);
+}
+
+static int Run(unsigned long baud, unsigned int seconds)
+{
+    unsigned long actual = InitUART(FCY, baud);
+    unsigned long line = actual / 10; // Bytes a second, start and stop bits around each
+    unsigned long seq = _rx.next;
+    hostBusStats_t before;
+    hostBusStats_t after;
+    run_t over;
+    run_t under;
+    double rate;
+
+    GetHostUartStats(&before);
+    if(Full(baud, seconds, &seq, &rate) < 0) return -1;
+    if(rate < FULL_MIN * line) {
+        printf("FAIL %lu baud, kept full: %.0f bytes/s of %lu\n", baud, rate, line);
+        return -1;
+    }
+    if(Offered(baud, actual, seconds, 2.0, &seq, &over) < 0) return -1;
+    if(over.dropped == 0) {
+        printf("FAIL %lu baud, overloaded: nothing dropped\n", baud);
+        return -1;
+    }
+    if(Offered(baud, actual, seconds, 0.8, &seq, &under) < 0) return -1;
+    if(under.dropped != 0) {
+        printf("FAIL %lu baud, under the line rate: %lu dropped\n", baud, under.dropped);
+        return -1;
+    }
+    GetHostUartStats(&after);
+
+    printf("%7lu %8lu %7lu   %7.0f %5.1f%%   %6lu %6lu %5.1f%%   %6lu %6lu   %6lu\n", baud, actual, line,
+            rate, 100 * rate / line, over.offered, over.dropped, 100.0 * over.bytes / over.seconds / line,
+            under.offered, under.dropped, after.transfers - before.transfers);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int seconds = 2;
+    unsigned int i = 0;
+
+    if(argc == 3 && strcmp(argv[1], "-s") == 0) seconds = atoi(argv[2]);
+    else if(argc != 1) seconds = 0;
+    if(seconds == 0) {
+        fprintf(stderr, "usage: %s [-s seconds]\n", argv[0]);
+        return 1;
+    }
+
+    HostInit(FCY);
+    HostUartAttach(Receive, 0);
+    printf("%u s a rate at %lu Hz, %u byte records when offered at 2x and 0.8x the line\n", seconds,
+            (unsigned long) FCY, OFFER_LEN + 4);
+    printf("   baud   actual  line B/s  kept full        2x offered             0.8x offered    DMA2\n");
+    printf("                            bytes/s   line   records dropped taken records dropped  chunks\n");
+    for(; i < sizeof(bauds) / sizeof(bauds[0]); ++i) {
+        if(Run(bauds[i], seconds) < 0) return 1;
+    }
+    return 0;
+}